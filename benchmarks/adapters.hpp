@@ -0,0 +1,190 @@
+#ifndef LOCKFREE_BENCHMARKS_ADAPTERS_HPP
+#define LOCKFREE_BENCHMARKS_ADAPTERS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "lockfree.hpp"
+
+namespace bench {
+
+/*
+   Gives all containers the same bulk interface, both calls transfer as many
+   elements as possible up to the count and return the number transferred.
+ */
+template <typename Container> struct Adapter;
+
+template <typename T, size_t size, typename StatsPolicy>
+struct Adapter<lockfree::spsc::Queue<T, size, StatsPolicy>> {
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    using C = lockfree::spsc::Queue<T, size, StatsPolicy>;
+
+    static size_t Send(C &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt && c.Push(src[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(C &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+template <typename T, size_t size>
+struct Adapter<lockfree::spsc::RingBuf<T, size>> {
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    static size_t Send(lockfree::spsc::RingBuf<T, size> &c, const T *src,
+                       size_t cnt) {
+        cnt = std::min(cnt, c.GetFree());
+        return (cnt != 0U && c.Write(src, cnt)) ? cnt : 0U;
+    }
+
+    static size_t Receive(lockfree::spsc::RingBuf<T, size> &c, T *dst,
+                          size_t cnt) {
+        cnt = std::min(cnt, c.GetAvailable());
+        return (cnt != 0U && c.Read(dst, cnt)) ? cnt : 0U;
+    }
+};
+
+template <typename T, size_t size>
+struct Adapter<lockfree::spsc::BipartiteBuf<T, size>> {
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    static size_t Send(lockfree::spsc::BipartiteBuf<T, size> &c, const T *src,
+                       size_t cnt) {
+        auto region = c.WriteAcquireMax(1U);
+        if (region.first == nullptr) {
+            return 0U;
+        }
+        cnt = std::min(cnt, region.second);
+        memcpy(region.first, src, cnt * sizeof(T));
+        c.WriteRelease(cnt);
+        return cnt;
+    }
+
+    static size_t Receive(lockfree::spsc::BipartiteBuf<T, size> &c, T *dst,
+                          size_t cnt) {
+        auto region = c.ReadAcquire();
+        if (region.first == nullptr) {
+            return 0U;
+        }
+        cnt = std::min(cnt, region.second);
+        memcpy(dst, region.first, cnt * sizeof(T));
+        c.ReadRelease(cnt);
+        return cnt;
+    }
+};
+
+template <typename T, size_t size, size_t priority_count>
+struct Adapter<lockfree::spsc::PriorityQueue<T, size, priority_count>> {
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    using C = lockfree::spsc::PriorityQueue<T, size, priority_count>;
+
+    static size_t Send(C &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt &&
+               c.Push(src[sent], src[sent].seq % priority_count)) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(C &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+template <typename T, size_t size, typename StatsPolicy>
+struct Adapter<lockfree::mpmc::Queue<T, size, StatsPolicy>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    using C = lockfree::mpmc::Queue<T, size, StatsPolicy>;
+
+    static size_t Send(C &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt && c.Push(src[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(C &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+template <typename T, size_t size, size_t priority_count>
+struct Adapter<lockfree::mpmc::PriorityQueue<T, size, priority_count>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    using C = lockfree::mpmc::PriorityQueue<T, size, priority_count>;
+
+    static size_t Send(C &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt &&
+               c.Push(src[sent], src[sent].seq % priority_count)) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(C &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+template <typename T, size_t size, size_t shards>
+struct Adapter<lockfree::mpmc::ShardedQueue<T, size, shards>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    using C = lockfree::mpmc::ShardedQueue<T, size, shards>;
+
+    static size_t Send(C &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt && c.Push(src[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(C &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_ADAPTERS_HPP */
@@ -0,0 +1,56 @@
+#ifndef LOCKFREE_BENCHMARKS_CLOCK_HPP
+#define LOCKFREE_BENCHMARKS_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define LOCKFREE_BENCHMARKS_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LOCKFREE_BENCHMARKS_TSC
+#endif
+
+namespace bench {
+
+/*
+   Reads a cheap monotonic tick counter: the TSC on x86, the virtual counter
+   on AArch64 and the steady clock in nanoseconds elsewhere. The TSC is
+   assumed to be invariant and synchronized between cores, which holds for
+   any x86 CPU from the last decade.
+ */
+inline uint64_t Ticks() {
+#if defined(LOCKFREE_BENCHMARKS_TSC)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+/* Measures the tick period against the steady clock */
+inline double CalibrateNsPerTick() {
+    using namespace std::chrono;
+
+    const auto start = steady_clock::now();
+    const uint64_t start_ticks = Ticks();
+    while (steady_clock::now() - start < milliseconds(100)) {
+    }
+    const uint64_t end_ticks = Ticks();
+    const auto end = steady_clock::now();
+
+    const auto elapsed = duration_cast<nanoseconds>(end - start).count();
+    return static_cast<double>(elapsed) /
+           static_cast<double>(end_ticks - start_ticks);
+}
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_CLOCK_HPP */
@@ -0,0 +1,252 @@
+#ifndef LOCKFREE_BENCHMARKS_COMMON_HPP
+#define LOCKFREE_BENCHMARKS_COMMON_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bench {
+
+/* Element of a given size in bytes, carrying a sequence number */
+template <size_t size> struct Payload {
+    static_assert(size > sizeof(uint32_t), "Payload must fit the sequence");
+    uint32_t seq;
+    uint8_t pad[size - sizeof(uint32_t)];
+};
+
+template <> struct Payload<sizeof(uint32_t)> {
+    uint32_t seq;
+};
+
+/* Element of a given size in bytes, carrying a send timestamp in ticks */
+template <size_t size> struct Stamped {
+    static_assert(size > sizeof(uint64_t) + sizeof(uint32_t),
+                  "Stamped must fit the timestamp and the sequence");
+    uint64_t stamp;
+    uint32_t seq;
+    uint8_t pad[size - sizeof(uint64_t) - sizeof(uint32_t)];
+};
+
+/* Percentiles reported by the tail latency benchmarks */
+constexpr double tail_percentiles[] = {50.0, 90.0, 99.0,    99.9,
+                                       99.99, 99.999, 100.0};
+constexpr size_t tail_percentile_count =
+    sizeof(tail_percentiles) / sizeof(tail_percentiles[0]);
+
+struct Options {
+    std::string filter;        /**< Substring the benchmark name must match */
+    std::vector<size_t> sizes; /**< Element sizes to run, all if empty */
+    std::vector<size_t> capacities; /**< Capacities to run, all if empty */
+    std::vector<int> cpus;     /**< CPUs to pin threads to, none if empty */
+    size_t producers = 1U;     /**< Producer threads for mpmc containers */
+    size_t consumers = 1U;     /**< Consumer threads for mpmc containers */
+    size_t elements = 1000000U; /**< Elements transferred per run */
+    size_t batch = 16U;        /**< Elements per bulk operation */
+    size_t repetitions = 3U;   /**< Runs per benchmark, the best is kept */
+    bool throughput = true;    /**< Run streaming throughput benchmarks */
+    bool latency = true;       /**< Run ping-pong latency benchmarks */
+    bool tail = false;         /**< Run only the tail latency benchmarks */
+    double rate = 1000000.0;   /**< Offered load of tail benchmarks, ops/s */
+    bool uncorrected = false;  /**< Stamp the actual instead of intended time */
+    double ns_per_tick = 1.0;  /**< Tick period of the benchmark clock */
+    std::string json;          /**< JSON output file, none if empty */
+};
+
+struct Result {
+    std::string container;
+    std::string workload;
+    size_t element_size;
+    size_t capacity;
+    size_t producers;
+    size_t consumers;
+    size_t elements;
+    double seconds;
+    double ops_per_sec;
+    double ns_per_op;
+    std::vector<double> percentiles; /**< Tail latencies in ns, if measured */
+};
+
+/* Parses a comma separated list of numbers */
+template <typename Number>
+inline std::vector<Number> ParseList(const char *arg) {
+    std::vector<Number> values;
+    const char *pos = arg;
+    while (*pos != '\0') {
+        char *end = nullptr;
+        values.push_back(static_cast<Number>(std::strtol(pos, &end, 10)));
+        if (end == pos) {
+            break;
+        }
+        pos = (*end == ',') ? end + 1 : end;
+    }
+    return values;
+}
+
+/* Checks if a filter list contains the value, empty lists contain all */
+template <typename Number>
+inline bool Contains(const std::vector<Number> &values, Number value) {
+    if (values.empty()) {
+        return true;
+    }
+    for (const Number &v : values) {
+        if (v == value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Pins the calling thread to the CPU assigned to the given thread index */
+inline void PinThread(const Options &options, size_t thread_index) {
+#if defined(__linux__)
+    if (options.cpus.empty()) {
+        return;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(options.cpus[thread_index % options.cpus.size()], &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)options;
+    (void)thread_index;
+#endif
+}
+
+/* Lets all benchmark threads start at the same time */
+class StartBarrier {
+  public:
+    explicit StartBarrier(size_t threads) : _waiting(threads) {}
+
+    void Wait() {
+        _waiting.fetch_sub(1U, std::memory_order_acq_rel);
+        while (_waiting.load(std::memory_order_acquire) != 0U) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    std::atomic_size_t _waiting;
+};
+
+/* Spins on a failed operation, yielding now and then so that oversubscribed
+   runs still make progress */
+class Backoff {
+  public:
+    void Pause() {
+        if (++_spins % 1024U == 0U) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    size_t _spins = 0U;
+};
+
+inline double SecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+/* Describes the library configuration the benchmarks were built with */
+inline void PrintConfig() {
+    std::printf("LOCKFREE_CACHE_COHERENT=%s LOCKFREE_CACHELINE_LENGTH=%u\n",
+                LOCKFREE_CACHE_COHERENT ? "true" : "false",
+                static_cast<unsigned>(LOCKFREE_CACHELINE_LENGTH));
+}
+
+inline void PrintHeader() {
+    std::printf("%-32s %-11s %6s %8s %4s %4s %14s %10s\n", "container",
+                "workload", "size", "capacity", "P", "C", "ops/s", "ns/op");
+}
+
+inline void PrintResult(const Result &r) {
+    std::printf("%-32s %-11s %6zu %8zu %4zu %4zu %14.0f %10.1f\n",
+                r.container.c_str(), r.workload.c_str(), r.element_size,
+                r.capacity, r.producers, r.consumers, r.ops_per_sec,
+                r.ns_per_op);
+    std::fflush(stdout);
+}
+
+inline void PrintTailHeader() {
+    std::printf("%-32s %6s %8s %4s %4s %12s", "container", "size", "capacity",
+                "P", "C", "ops/s");
+    for (double percentile : tail_percentiles) {
+        char label[16];
+        if (percentile == 100.0) {
+            std::snprintf(label, sizeof(label), "max");
+        } else {
+            std::snprintf(label, sizeof(label), "p%g", percentile);
+        }
+        std::printf(" %10s", label);
+    }
+    std::printf("\n");
+}
+
+inline void PrintTailResult(const Result &r) {
+    std::printf("%-32s %6zu %8zu %4zu %4zu %12.0f", r.container.c_str(),
+                r.element_size, r.capacity, r.producers, r.consumers,
+                r.ops_per_sec);
+    for (double latency : r.percentiles) {
+        std::printf(" %10.0f", latency);
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+}
+
+inline bool WriteJson(const std::string &path,
+                      const std::vector<Result> &results) {
+    FILE *file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::fprintf(file,
+                 "{\n  \"cache_coherent\": %s,\n"
+                 "  \"cacheline_length\": %u,\n  \"results\": [\n",
+                 LOCKFREE_CACHE_COHERENT ? "true" : "false",
+                 static_cast<unsigned>(LOCKFREE_CACHELINE_LENGTH));
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        std::fprintf(file,
+                     "    {\"container\": \"%s\", \"workload\": \"%s\", "
+                     "\"element_size\": %zu, \"capacity\": %zu, "
+                     "\"producers\": %zu, \"consumers\": %zu, "
+                     "\"elements\": %zu, \"seconds\": %.9f, "
+                     "\"ops_per_sec\": %.3f, \"ns_per_op\": %.3f",
+                     r.container.c_str(), r.workload.c_str(), r.element_size,
+                     r.capacity, r.producers, r.consumers, r.elements,
+                     r.seconds, r.ops_per_sec, r.ns_per_op);
+        if (!r.percentiles.empty()) {
+            std::fprintf(file, ", \"percentiles_ns\": {");
+            for (size_t p = 0; p < r.percentiles.size(); p++) {
+                std::fprintf(file, "%s\"%g\": %.1f", p == 0U ? "" : ", ",
+                             tail_percentiles[p], r.percentiles[p]);
+            }
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+
+    std::fclose(file);
+    return true;
+}
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_COMMON_HPP */
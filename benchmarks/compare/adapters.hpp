@@ -0,0 +1,96 @@
+#ifndef LOCKFREE_BENCHMARKS_COMPARE_ADAPTERS_HPP
+#define LOCKFREE_BENCHMARKS_COMPARE_ADAPTERS_HPP
+
+#include <cstddef>
+
+#include "../adapters.hpp"
+#include "mutex_queue.hpp"
+#include "vyukov_queue.hpp"
+
+#if defined(LOCKFREE_BENCHMARKS_BOOST)
+#include <boost/lockfree/queue.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+#endif
+
+namespace bench {
+
+template <typename T, size_t size> struct Adapter<VyukovQueue<T, size>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    static size_t Send(VyukovQueue<T, size> &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt && c.Push(src[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(VyukovQueue<T, size> &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.Pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+
+template <typename T, size_t size> struct Adapter<MutexQueue<T, size>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    static size_t Send(MutexQueue<T, size> &c, const T *src, size_t cnt) {
+        return c.Push(src, cnt);
+    }
+
+    static size_t Receive(MutexQueue<T, size> &c, T *dst, size_t cnt) {
+        return c.Pop(dst, cnt);
+    }
+};
+
+#if defined(LOCKFREE_BENCHMARKS_BOOST)
+template <typename T, size_t size>
+using BoostSpscQueue =
+    boost::lockfree::spsc_queue<T, boost::lockfree::capacity<size>>;
+
+template <typename T, size_t size>
+using BoostQueue = boost::lockfree::queue<T, boost::lockfree::capacity<size>>;
+
+template <typename T, size_t size> struct Adapter<BoostSpscQueue<T, size>> {
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    static size_t Send(BoostSpscQueue<T, size> &c, const T *src, size_t cnt) {
+        return c.push(src, cnt);
+    }
+
+    static size_t Receive(BoostSpscQueue<T, size> &c, T *dst, size_t cnt) {
+        return c.pop(dst, cnt);
+    }
+};
+
+template <typename T, size_t size> struct Adapter<BoostQueue<T, size>> {
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    static size_t Send(BoostQueue<T, size> &c, const T *src, size_t cnt) {
+        size_t sent = 0;
+        while (sent < cnt && c.bounded_push(src[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    static size_t Receive(BoostQueue<T, size> &c, T *dst, size_t cnt) {
+        size_t received = 0;
+        while (received < cnt && c.pop(dst[received])) {
+            received++;
+        }
+        return received;
+    }
+};
+#endif
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_COMPARE_ADAPTERS_HPP */
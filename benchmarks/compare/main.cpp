@@ -0,0 +1,206 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "lockfree.hpp"
+
+#include "../common.hpp"
+#include "../workloads.hpp"
+#include "adapters.hpp"
+
+namespace {
+
+using namespace bench;
+
+/* Aliases keep the default policies out of template template arguments */
+template <typename T, size_t size>
+using SpscQueue = lockfree::spsc::Queue<T, size>;
+
+template <typename T, size_t size>
+using MpmcQueue = lockfree::mpmc::Queue<T, size>;
+
+struct Workload {
+    const char *name;
+    bool multi_producer;
+    bool multi_consumer;
+};
+
+constexpr Workload workloads[] = {
+    {"1P1C", false, false},
+    {"NP1C", true, false},
+    {"1PNC", false, true},
+    {"NPNC", true, true},
+};
+
+struct Candidate {
+    std::string name;
+    size_t element_size;
+    size_t capacity;
+    bool multi_producer;
+    bool multi_consumer;
+    std::function<bool(const Options &, size_t, size_t, Result &)> run;
+};
+
+template <template <typename, size_t> class Container, size_t element_size,
+          size_t capacity>
+void Register(std::vector<Candidate> &candidates, const char *name) {
+    using T = Payload<element_size>;
+    using C = Container<T, capacity>;
+
+    candidates.push_back({name, element_size, capacity,
+                          Adapter<C>::multi_producer,
+                          Adapter<C>::multi_consumer, RunStreaming<C, T>});
+}
+
+template <template <typename, size_t> class Container, size_t element_size>
+void RegisterCapacities(std::vector<Candidate> &candidates, const char *name) {
+    Register<Container, element_size, 64U>(candidates, name);
+    Register<Container, element_size, 1024U>(candidates, name);
+    Register<Container, element_size, 16384U>(candidates, name);
+}
+
+template <template <typename, size_t> class Container>
+void RegisterSizes(std::vector<Candidate> &candidates, const char *name) {
+    RegisterCapacities<Container, 4U>(candidates, name);
+    RegisterCapacities<Container, 16U>(candidates, name);
+    RegisterCapacities<Container, 64U>(candidates, name);
+    RegisterCapacities<Container, 256U>(candidates, name);
+}
+
+std::vector<Candidate> RegisterAll() {
+    std::vector<Candidate> candidates;
+
+    RegisterSizes<SpscQueue>(candidates, "lockfree::spsc::Queue");
+    RegisterSizes<MpmcQueue>(candidates, "lockfree::mpmc::Queue");
+#if defined(LOCKFREE_BENCHMARKS_BOOST)
+    RegisterSizes<BoostSpscQueue>(candidates, "boost::lockfree::spsc_queue");
+    RegisterSizes<BoostQueue>(candidates, "boost::lockfree::queue");
+#endif
+    RegisterSizes<VyukovQueue>(candidates, "vyukov::BoundedQueue");
+    RegisterSizes<MutexQueue>(candidates, "std::mutex+std::deque");
+
+    return candidates;
+}
+
+void PrintUsage(const char *program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --filter <text>          Run queues whose name contains text\n"
+        "  --workloads <name,...>   Workloads (1P1C,NP1C,1PNC,NPNC)\n"
+        "  --sizes <n,...>          Element sizes in bytes (4,16,64,256)\n"
+        "  --capacities <n,...>     Capacities (64,1024,16384)\n"
+        "  --threads <n>            Threads on the N side of a workload\n"
+        "  --cpus <n,...>           CPUs to pin threads to, in thread order\n"
+        "  --elements <n>           Elements per run\n"
+        "  --batch <n>              Elements per bulk operation\n"
+        "  --repetitions <n>        Runs per benchmark, the best is kept\n"
+        "  --json <file>            Also write the results as JSON\n",
+        program);
+}
+
+bool ParseOptions(int argc, char **argv, Options &options,
+                  std::string &workload_filter) {
+    options.capacities = {1024U};
+    options.producers = 2U;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char *arg = argv[i];
+        const char *value = argv[i + 1];
+
+        if (std::strcmp(arg, "--filter") == 0) {
+            options.filter = value;
+        } else if (std::strcmp(arg, "--workloads") == 0) {
+            workload_filter = value;
+        } else if (std::strcmp(arg, "--sizes") == 0) {
+            options.sizes = ParseList<size_t>(value);
+        } else if (std::strcmp(arg, "--capacities") == 0) {
+            options.capacities = ParseList<size_t>(value);
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            options.producers = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--cpus") == 0) {
+            options.cpus = ParseList<int>(value);
+        } else if (std::strcmp(arg, "--elements") == 0) {
+            options.elements = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--batch") == 0) {
+            options.batch = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--repetitions") == 0) {
+            options.repetitions = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--json") == 0) {
+            options.json = value;
+        } else {
+            return false;
+        }
+    }
+    options.consumers = options.producers;
+
+    return argc % 2 == 1 && options.producers != 0U &&
+           options.elements != 0U && options.repetitions != 0U;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    std::string workload_filter;
+    if (!ParseOptions(argc, argv, options, workload_filter)) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<Candidate> candidates = RegisterAll();
+    std::vector<Result> results;
+    bool ok = true;
+
+    PrintConfig();
+    PrintHeader();
+    for (const Workload &w : workloads) {
+        if (!workload_filter.empty() &&
+            workload_filter.find(w.name) == std::string::npos) {
+            continue;
+        }
+
+        const size_t producers = w.multi_producer ? options.producers : 1U;
+        const size_t consumers = w.multi_consumer ? options.consumers : 1U;
+
+        for (const Candidate &c : candidates) {
+            if (c.name.find(options.filter) == std::string::npos ||
+                !Contains(options.sizes, c.element_size) ||
+                !Contains(options.capacities, c.capacity) ||
+                (w.multi_producer && !c.multi_producer) ||
+                (w.multi_consumer && !c.multi_consumer)) {
+                continue;
+            }
+
+            Result best = {};
+            for (size_t r = 0; r < options.repetitions; r++) {
+                Result result = {};
+                if (!c.run(options, producers, consumers, result)) {
+                    std::fprintf(stderr, "%s: throughput checksum mismatch\n",
+                                 c.name.c_str());
+                    ok = false;
+                    break;
+                }
+                if (r == 0U || result.seconds < best.seconds) {
+                    best = result;
+                }
+            }
+
+            best.container = c.name;
+            best.workload = w.name;
+            best.element_size = c.element_size;
+            best.capacity = c.capacity;
+            PrintResult(best);
+            results.push_back(best);
+        }
+    }
+
+    if (!options.json.empty() && !WriteJson(options.json, results)) {
+        std::fprintf(stderr, "Could not write %s\n", options.json.c_str());
+        ok = false;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
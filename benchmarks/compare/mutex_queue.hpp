@@ -0,0 +1,39 @@
+#ifndef LOCKFREE_BENCHMARKS_MUTEX_QUEUE_HPP
+#define LOCKFREE_BENCHMARKS_MUTEX_QUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace bench {
+
+/*
+   Bounded std::deque behind a std::mutex, the baseline every lock-free
+   queue has to beat. Bulk operations take the lock once per batch.
+ */
+template <typename T, size_t size> class MutexQueue {
+  public:
+    size_t Push(const T *src, size_t cnt) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cnt = std::min(cnt, size - _deque.size());
+        _deque.insert(_deque.end(), src, src + cnt);
+        return cnt;
+    }
+
+    size_t Pop(T *dst, size_t cnt) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cnt = std::min(cnt, _deque.size());
+        std::copy(_deque.begin(), _deque.begin() + cnt, dst);
+        _deque.erase(_deque.begin(), _deque.begin() + cnt);
+        return cnt;
+    }
+
+  private:
+    std::mutex _mutex;
+    std::deque<T> _deque;
+};
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_MUTEX_QUEUE_HPP */
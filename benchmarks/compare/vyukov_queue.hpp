@@ -0,0 +1,88 @@
+#ifndef LOCKFREE_BENCHMARKS_VYUKOV_QUEUE_HPP
+#define LOCKFREE_BENCHMARKS_VYUKOV_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace bench {
+
+/*
+   Dmitry Vyukov's bounded MPMC queue, as published at
+   https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+   Every cell carries a sequence number telling producers and consumers
+   whether it is their turn, the indexes are claimed with a CAS.
+ */
+template <typename T, size_t size> class VyukovQueue {
+    static_assert((size & (size - 1)) == 0, "Buffer size must be a power of 2");
+
+  public:
+    VyukovQueue() {
+        for (size_t i = 0; i < size; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool Push(const T &element) {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        Cell *cell;
+        for (;;) {
+            cell = &_cells[pos & (size - 1)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t dif =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0) {
+                if (_enqueue_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = element;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T &element) {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        Cell *cell;
+        for (;;) {
+            cell = &_cells[pos & (size - 1)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t dif =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (dif == 0) {
+                if (_dequeue_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                return false;
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        element = cell->data;
+        cell->sequence.store(pos + size, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    struct Cell {
+        std::atomic_size_t sequence;
+        T data;
+    };
+
+    static constexpr size_t cacheline = 64U;
+
+    alignas(cacheline) Cell _cells[size];
+    alignas(cacheline) std::atomic_size_t _enqueue_pos{0U};
+    alignas(cacheline) std::atomic_size_t _dequeue_pos{0U};
+};
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_VYUKOV_QUEUE_HPP */
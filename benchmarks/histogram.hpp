@@ -0,0 +1,110 @@
+#ifndef LOCKFREE_BENCHMARKS_HISTOGRAM_HPP
+#define LOCKFREE_BENCHMARKS_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bench {
+
+/*
+   Log-linear histogram in the style of HdrHistogram. Values below
+   2 * sub_bucket_count are counted exactly, every following power of two is
+   split into sub_bucket_count linear buckets, bounding the relative error
+   to 1 / sub_bucket_count over the whole 64-bit range.
+ */
+class Histogram {
+  public:
+    Histogram() : _counts(bucket_count, 0U) {}
+
+    void Record(uint64_t value) {
+        _counts[Index(value)]++;
+        _total++;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+    }
+
+    void Merge(const Histogram &other) {
+        for (size_t i = 0; i < bucket_count; i++) {
+            _counts[i] += other._counts[i];
+        }
+        _total += other._total;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+
+    uint64_t GetCount() const { return _total; }
+
+    /* Returns the highest value equivalent to the given percentile */
+    uint64_t GetPercentile(double percentile) const {
+        if (_total == 0U) {
+            return 0U;
+        }
+
+        const double rank = std::ceil(percentile / 100.0 *
+                                      static_cast<double>(_total));
+        const uint64_t target =
+            std::max<uint64_t>(static_cast<uint64_t>(rank), 1U);
+
+        uint64_t seen = 0U;
+        for (size_t i = 0; i < bucket_count; i++) {
+            seen += _counts[i];
+            if (seen >= target) {
+                return std::min(HighestEquivalent(i), _max);
+            }
+        }
+        return _max;
+    }
+
+    uint64_t GetMin() const { return _total == 0U ? 0U : _min; }
+
+    uint64_t GetMax() const { return _max; }
+
+  private:
+    static constexpr unsigned sub_bucket_bits = 7U;
+    static constexpr uint64_t sub_bucket_count = 1U << sub_bucket_bits;
+    static constexpr size_t bucket_count =
+        (64U - sub_bucket_bits) * sub_bucket_count + sub_bucket_count;
+
+    static unsigned MostSignificantBit(uint64_t value) {
+#if defined(__GNUC__)
+        return 63U - static_cast<unsigned>(__builtin_clzll(value));
+#else
+        unsigned msb = 0U;
+        while (value >>= 1U) {
+            msb++;
+        }
+        return msb;
+#endif
+    }
+
+    static size_t Index(uint64_t value) {
+        if (value < 2U * sub_bucket_count) {
+            return static_cast<size_t>(value);
+        }
+        const unsigned shift = MostSignificantBit(value) - sub_bucket_bits;
+        return static_cast<size_t>(shift * sub_bucket_count +
+                                   (value >> shift));
+    }
+
+    static uint64_t HighestEquivalent(size_t index) {
+        if (index < 2U * sub_bucket_count) {
+            return index;
+        }
+        const unsigned shift =
+            static_cast<unsigned>(index / sub_bucket_count) - 1U;
+        const uint64_t sub_bucket = index % sub_bucket_count + sub_bucket_count;
+        return ((sub_bucket + 1U) << shift) - 1U;
+    }
+
+    std::vector<uint64_t> _counts;
+    uint64_t _total = 0U;
+    uint64_t _min = UINT64_MAX;
+    uint64_t _max = 0U;
+};
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_HISTOGRAM_HPP */
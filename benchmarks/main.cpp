@@ -0,0 +1,262 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "lockfree.hpp"
+
+#include "common.hpp"
+#include "workloads.hpp"
+
+namespace {
+
+using namespace bench;
+
+constexpr size_t priority_count = 4U;
+constexpr size_t shard_count = 4U;
+
+/* Aliases keep the default policies out of template template arguments */
+template <typename T, size_t size>
+using SpscQueue = lockfree::spsc::Queue<T, size>;
+
+template <typename T, size_t size>
+using MpmcQueue = lockfree::mpmc::Queue<T, size>;
+
+template <typename T, size_t size>
+using SpscPriorityQueue =
+    lockfree::spsc::PriorityQueue<T, size, priority_count>;
+
+template <typename T, size_t size>
+using MpmcPriorityQueue =
+    lockfree::mpmc::PriorityQueue<T, size, priority_count>;
+
+/* The capacity is split between the shards to keep the total comparable */
+template <typename T, size_t size>
+using MpmcShardedQueue =
+    lockfree::mpmc::ShardedQueue<T, size / shard_count, shard_count>;
+
+struct Benchmark {
+    std::string name;
+    size_t element_size;
+    size_t capacity;
+    std::function<bool(const Options &, Result &)> throughput;
+    std::function<bool(const Options &, Result &)> latency;
+    std::function<bool(const Options &, Result &)> tail;
+};
+
+template <template <typename, size_t> class Container, size_t element_size,
+          size_t capacity>
+void Register(std::vector<Benchmark> &benchmarks, const char *name) {
+    using T = Payload<element_size>;
+    using C = Container<T, capacity>;
+
+    Benchmark b = {name, element_size, capacity, RunThroughput<C, T>,
+                   RunLatency<C, T>, nullptr};
+
+    /* Only elements big enough to carry a timestamp can measure tail latency */
+    if constexpr (element_size >= 16U) {
+        using S = Stamped<element_size>;
+        b.tail = RunTail<Container<S, capacity>, S>;
+    }
+
+    benchmarks.push_back(b);
+}
+
+template <template <typename, size_t> class Container, size_t element_size>
+void RegisterCapacities(std::vector<Benchmark> &benchmarks, const char *name) {
+    Register<Container, element_size, 64U>(benchmarks, name);
+    Register<Container, element_size, 1024U>(benchmarks, name);
+    Register<Container, element_size, 16384U>(benchmarks, name);
+}
+
+template <template <typename, size_t> class Container>
+void RegisterSizes(std::vector<Benchmark> &benchmarks, const char *name) {
+    RegisterCapacities<Container, 4U>(benchmarks, name);
+    RegisterCapacities<Container, 16U>(benchmarks, name);
+    RegisterCapacities<Container, 64U>(benchmarks, name);
+    RegisterCapacities<Container, 256U>(benchmarks, name);
+}
+
+std::vector<Benchmark> RegisterAll() {
+    std::vector<Benchmark> benchmarks;
+
+    RegisterSizes<SpscQueue>(benchmarks, "spsc::Queue");
+    RegisterSizes<lockfree::spsc::RingBuf>(benchmarks, "spsc::RingBuf");
+    RegisterSizes<lockfree::spsc::BipartiteBuf>(benchmarks,
+                                                "spsc::BipartiteBuf");
+    RegisterSizes<SpscPriorityQueue>(benchmarks, "spsc::PriorityQueue");
+    RegisterSizes<MpmcQueue>(benchmarks, "mpmc::Queue");
+    RegisterSizes<MpmcPriorityQueue>(benchmarks, "mpmc::PriorityQueue");
+    RegisterSizes<MpmcShardedQueue>(benchmarks, "mpmc::ShardedQueue");
+
+    return benchmarks;
+}
+
+void PrintUsage(const char *program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --filter <text>          Run containers whose name contains text\n"
+        "  --sizes <n,...>          Element sizes in bytes (4,16,64,256)\n"
+        "  --capacities <n,...>     Capacities (64,1024,16384)\n"
+        "  --cpus <n,...>           CPUs to pin threads to, in thread order\n"
+        "  --producers <n>          Producer threads for mpmc containers\n"
+        "  --consumers <n>          Consumer threads for mpmc containers\n"
+        "  --elements <n>           Elements or round trips per run\n"
+        "  --batch <n>              Elements per bulk operation\n"
+        "  --repetitions <n>        Runs per benchmark, the best is kept\n"
+        "  --throughput-only        Skip the latency benchmarks\n"
+        "  --latency-only           Skip the throughput benchmarks\n"
+        "  --tail                   Only run the tail latency benchmarks\n"
+        "  --rate <n>               Offered load of tail benchmarks, ops/s\n"
+        "  --uncorrected            Measure tail latency from the actual\n"
+        "                           send time, without correcting for\n"
+        "                           coordinated omission\n"
+        "  --json <file>            Also write the results as JSON\n",
+        program);
+}
+
+bool ParseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (std::strcmp(arg, "--throughput-only") == 0) {
+            options.latency = false;
+        } else if (std::strcmp(arg, "--latency-only") == 0) {
+            options.throughput = false;
+        } else if (std::strcmp(arg, "--tail") == 0) {
+            options.tail = true;
+        } else if (std::strcmp(arg, "--uncorrected") == 0) {
+            options.uncorrected = true;
+        } else if (!has_value) {
+            return false;
+        } else if (std::strcmp(arg, "--filter") == 0) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--sizes") == 0) {
+            options.sizes = ParseList<size_t>(argv[++i]);
+        } else if (std::strcmp(arg, "--capacities") == 0) {
+            options.capacities = ParseList<size_t>(argv[++i]);
+        } else if (std::strcmp(arg, "--cpus") == 0) {
+            options.cpus = ParseList<int>(argv[++i]);
+        } else if (std::strcmp(arg, "--producers") == 0) {
+            options.producers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--consumers") == 0) {
+            options.consumers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--elements") == 0) {
+            options.elements = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--batch") == 0) {
+            options.batch = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--repetitions") == 0) {
+            options.repetitions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--rate") == 0) {
+            options.rate = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--json") == 0) {
+            options.json = argv[++i];
+        } else {
+            return false;
+        }
+    }
+
+    return options.producers != 0U && options.consumers != 0U &&
+           options.elements != 0U && options.repetitions != 0U &&
+           options.rate > 0.0;
+}
+
+/* Runs a workload the requested number of times and keeps the fastest run */
+bool RunBest(const std::function<bool(const Options &, Result &)> &workload,
+             const Options &options, Result &best) {
+    for (size_t i = 0; i < options.repetitions; i++) {
+        Result result = best;
+        if (!workload(options, result)) {
+            return false;
+        }
+        if (i == 0U || result.seconds < best.seconds) {
+            best = result;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Result> results;
+    bool ok = true;
+
+    if (options.tail) {
+        options.throughput = false;
+        options.latency = false;
+        options.ns_per_tick = CalibrateNsPerTick();
+    }
+
+    PrintConfig();
+    if (options.tail) {
+        PrintTailHeader();
+    } else {
+        PrintHeader();
+    }
+
+    for (const Benchmark &b : RegisterAll()) {
+        if (b.name.find(options.filter) == std::string::npos ||
+            !Contains(options.sizes, b.element_size) ||
+            !Contains(options.capacities, b.capacity)) {
+            continue;
+        }
+
+        Result result = {};
+        result.container = b.name;
+        result.element_size = b.element_size;
+        result.capacity = b.capacity;
+
+        if (options.throughput) {
+            result.workload = "throughput";
+            if (RunBest(b.throughput, options, result)) {
+                PrintResult(result);
+                results.push_back(result);
+            } else {
+                std::fprintf(stderr, "%s: throughput checksum mismatch\n",
+                             b.name.c_str());
+                ok = false;
+            }
+        }
+
+        if (options.latency) {
+            result.workload = "latency";
+            if (RunBest(b.latency, options, result)) {
+                PrintResult(result);
+                results.push_back(result);
+            } else {
+                std::fprintf(stderr, "%s: latency sequence mismatch\n",
+                             b.name.c_str());
+                ok = false;
+            }
+        }
+
+        if (options.tail && b.tail) {
+            result.workload = "tail";
+            if (b.tail(options, result)) {
+                PrintTailResult(result);
+                results.push_back(result);
+            } else {
+                std::fprintf(stderr, "%s: tail latency sample mismatch\n",
+                             b.name.c_str());
+                ok = false;
+            }
+        }
+    }
+
+    if (!options.json.empty() && !WriteJson(options.json, results)) {
+        std::fprintf(stderr, "Could not write %s\n", options.json.c_str());
+        ok = false;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,363 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "reclaim/epoch.hpp"
+#include "reclaim/hazard_pointers.hpp"
+
+#include "../common.hpp"
+
+namespace {
+
+using namespace bench;
+
+constexpr size_t max_threads = 64U;
+constexpr size_t retire_size = 1024U;
+constexpr size_t list_length = 64U;
+
+using Epoch = lockfree::reclaim::Epoch<max_threads, retire_size>;
+using HazardPointers =
+    lockfree::reclaim::HazardPointers<max_threads, 2U, retire_size>;
+
+struct Node {
+    Node(uint64_t v, Node *n) : value(v), next(n) {}
+
+    uint64_t value;
+    std::atomic<Node *> next;
+};
+
+/* Runs a body on every thread, returning the seconds the slowest took */
+double RunThreads(const Options &options, size_t threads,
+                  const std::function<void(size_t)> &body) {
+    StartBarrier barrier(threads + 1U);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&options, &barrier, &body, t]() {
+            PinThread(options, t);
+            barrier.Wait();
+            body(t);
+        });
+    }
+
+    barrier.Wait();
+    const auto start = std::chrono::steady_clock::now();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return SecondsSince(start);
+}
+
+/* Every thread enters and leaves a critical section in a loop */
+double RunEpochGuard(const Options &options, size_t threads) {
+    Epoch epoch;
+    std::atomic<uint64_t> sink(0U);
+
+    return RunThreads(options, threads, [&](size_t) {
+        size_t thread = 0;
+        if (!epoch.Register(thread)) {
+            return;
+        }
+        uint64_t sum = 0U;
+        for (size_t i = 0; i < options.elements; i++) {
+            Epoch::Guard guard(epoch, thread);
+            sum += i;
+        }
+        sink.fetch_add(sum, std::memory_order_relaxed);
+        epoch.Unregister(thread);
+    });
+}
+
+/* Every thread protects and releases a shared object in a loop */
+double RunHazardProtect(const Options &options, size_t threads) {
+    HazardPointers hp;
+    Node node(1U, nullptr);
+    std::atomic<Node *> shared(&node);
+    std::atomic<uint64_t> sink(0U);
+
+    return RunThreads(options, threads, [&](size_t) {
+        size_t thread = 0;
+        if (!hp.Register(thread)) {
+            return;
+        }
+        uint64_t sum = 0U;
+        for (size_t i = 0; i < options.elements; i++) {
+            sum += hp.Protect(thread, 0U, shared)->value;
+            hp.Clear(thread, 0U);
+        }
+        sink.fetch_add(sum, std::memory_order_relaxed);
+        hp.Unregister(thread);
+    });
+}
+
+/* Every thread retires freshly allocated nodes, reclaiming in batches */
+double RunEpochRetire(const Options &options, size_t threads) {
+    Epoch epoch;
+
+    return RunThreads(options, threads, [&](size_t) {
+        size_t thread = 0;
+        if (!epoch.Register(thread)) {
+            return;
+        }
+        for (size_t i = 0; i < options.elements; i++) {
+            Node *node = new Node(i, nullptr);
+            {
+                Epoch::Guard guard(epoch, thread);
+                node->next.store(node, std::memory_order_relaxed);
+            }
+            /* Waiting inside a guard would keep the epoch from advancing */
+            while (!epoch.Retire(thread, node)) {
+                std::this_thread::yield();
+            }
+        }
+        epoch.Unregister(thread);
+    });
+}
+
+/* Every thread retires freshly allocated nodes, scanning when full */
+double RunHazardRetire(const Options &options, size_t threads) {
+    HazardPointers hp;
+
+    return RunThreads(options, threads, [&](size_t) {
+        size_t thread = 0;
+        if (!hp.Register(thread)) {
+            return;
+        }
+        for (size_t i = 0; i < options.elements; i++) {
+            Node *node = new Node(i, nullptr);
+            hp.Set(thread, 0U, node);
+            node->next.store(node, std::memory_order_relaxed);
+            hp.Clear(thread, 0U);
+            hp.Retire(thread, node);
+        }
+        hp.Unregister(thread);
+    });
+}
+
+/*
+ * Readers traverse a linked list from start to end, while a writer keeps
+ * replacing the first node and retiring the old one. Only the first node is
+ * ever retired, so its successor never changes while a reader holds it.
+ */
+template <typename Reclaim, typename Reader, typename Retirer>
+double RunTraverse(const Options &options, size_t threads, Reclaim &reclaim,
+                   const Reader &reader, const Retirer &retirer) {
+    Node *tail = nullptr;
+    for (size_t i = list_length; i-- > 1U;) {
+        tail = new Node(i, tail);
+    }
+    std::atomic<Node *> head(new Node(0U, tail));
+    std::atomic<size_t> running(threads);
+    std::atomic<uint64_t> sink(0U);
+
+    std::thread writer([&]() {
+        PinThread(options, threads);
+        size_t thread = 0;
+        if (!reclaim.Register(thread)) {
+            return;
+        }
+        while (running.load(std::memory_order_relaxed) != 0U) {
+            Node *old = head.load(std::memory_order_relaxed);
+            head.store(new Node(old->value + 1U,
+                                old->next.load(std::memory_order_relaxed)),
+                       std::memory_order_release);
+            retirer(thread, old);
+        }
+        reclaim.Unregister(thread);
+    });
+
+    const double seconds = RunThreads(options, threads, [&](size_t) {
+        size_t thread = 0;
+        if (reclaim.Register(thread)) {
+            uint64_t sum = 0U;
+            for (size_t i = 0; i < options.elements; i++) {
+                sum += reader(thread, head);
+            }
+            sink.fetch_add(sum, std::memory_order_relaxed);
+            reclaim.Unregister(thread);
+        }
+        running.fetch_sub(1U, std::memory_order_relaxed);
+    });
+    writer.join();
+
+    for (Node *node = head.load(); node != nullptr;) {
+        Node *next = node->next.load();
+        delete node;
+        node = next;
+    }
+    return seconds;
+}
+
+double RunEpochTraverse(const Options &options, size_t threads) {
+    Epoch epoch;
+
+    return RunTraverse(
+        options, threads, epoch,
+        [&epoch](size_t thread, const std::atomic<Node *> &head) {
+            /* A single guard covers the whole traversal */
+            Epoch::Guard guard(epoch, thread);
+            uint64_t sum = 0U;
+            for (Node *node = head.load(std::memory_order_acquire);
+                 node != nullptr;
+                 node = node->next.load(std::memory_order_acquire)) {
+                sum += node->value;
+            }
+            return sum;
+        },
+        [&epoch](size_t thread, Node *node) {
+            while (!epoch.Retire(thread, node)) {
+                std::this_thread::yield();
+            }
+        });
+}
+
+double RunHazardTraverse(const Options &options, size_t threads) {
+    HazardPointers hp;
+
+    return RunTraverse(
+        options, threads, hp,
+        [&hp](size_t thread, const std::atomic<Node *> &head) {
+            /* Hand over hand, every node is protected before it is read */
+            uint64_t sum = 0U;
+            size_t index = 0U;
+            Node *node = hp.Protect(thread, index, head);
+            while (node != nullptr) {
+                sum += node->value;
+                index ^= 1U;
+                node = hp.Protect(thread, index, node->next);
+            }
+            hp.Clear(thread, 0U);
+            hp.Clear(thread, 1U);
+            return sum;
+        },
+        [&hp](size_t thread, Node *node) { hp.Retire(thread, node); });
+}
+
+struct Benchmark {
+    const char *container;
+    const char *workload;
+    size_t element_size;
+    size_t capacity;
+    std::function<double(const Options &, size_t)> run;
+};
+
+const Benchmark benchmarks[] = {
+    {"reclaim::Epoch", "guard", 0U, retire_size, RunEpochGuard},
+    {"reclaim::HazardPointers", "guard", 0U, retire_size, RunHazardProtect},
+    {"reclaim::Epoch", "retire", sizeof(Node), retire_size, RunEpochRetire},
+    {"reclaim::HazardPointers", "retire", sizeof(Node), retire_size,
+     RunHazardRetire},
+    {"reclaim::Epoch", "traverse", sizeof(Node), list_length,
+     RunEpochTraverse},
+    {"reclaim::HazardPointers", "traverse", sizeof(Node), list_length,
+     RunHazardTraverse},
+};
+
+void PrintUsage(const char *program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --filter <text>          Run workloads whose name contains text\n"
+        "  --threads <n,...>        Thread counts (1,2,4)\n"
+        "  --cpus <n,...>           CPUs to pin threads to, in thread order\n"
+        "  --elements <n>           Operations per thread and run\n"
+        "  --repetitions <n>        Runs per benchmark, the best is kept\n"
+        "  --json <file>            Also write the results as JSON\n",
+        program);
+}
+
+bool ParseOptions(int argc, char **argv, Options &options,
+                  std::vector<size_t> &threads) {
+    threads = {1U, 2U, 4U};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char *arg = argv[i];
+        const char *value = argv[i + 1];
+
+        if (std::strcmp(arg, "--filter") == 0) {
+            options.filter = value;
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            threads = ParseList<size_t>(value);
+        } else if (std::strcmp(arg, "--cpus") == 0) {
+            options.cpus = ParseList<int>(value);
+        } else if (std::strcmp(arg, "--elements") == 0) {
+            options.elements = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--repetitions") == 0) {
+            options.repetitions = std::strtoul(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--json") == 0) {
+            options.json = value;
+        } else {
+            return false;
+        }
+    }
+
+    for (size_t count : threads) {
+        /* One slot is left for the writer of the traverse workload */
+        if (count == 0U || count >= max_threads) {
+            return false;
+        }
+    }
+
+    return argc % 2 == 1 && !threads.empty() && options.elements != 0U &&
+           options.repetitions != 0U;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    std::vector<size_t> threads;
+    if (!ParseOptions(argc, argv, options, threads)) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Result> results;
+    bool ok = true;
+
+    PrintConfig();
+    PrintHeader();
+    for (const Benchmark &b : benchmarks) {
+        const std::string name = std::string(b.container) + " " + b.workload;
+        if (name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        for (size_t count : threads) {
+            double best = 0.0;
+            for (size_t r = 0; r < options.repetitions; r++) {
+                const double seconds = b.run(options, count);
+                if (r == 0U || seconds < best) {
+                    best = seconds;
+                }
+            }
+
+            /* Operations are counted per thread, as they run independently */
+            Result result = {};
+            result.container = b.container;
+            result.workload = b.workload;
+            result.element_size = b.element_size;
+            result.capacity = b.capacity;
+            result.producers = count;
+            result.elements = options.elements;
+            result.seconds = best;
+            result.ops_per_sec =
+                static_cast<double>(options.elements * count) / best;
+            result.ns_per_op =
+                best * 1e9 / static_cast<double>(options.elements);
+            PrintResult(result);
+            results.push_back(result);
+        }
+    }
+
+    if (!options.json.empty() && !WriteJson(options.json, results)) {
+        std::fprintf(stderr, "Could not write %s\n", options.json.c_str());
+        ok = false;
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,299 @@
+#ifndef LOCKFREE_BENCHMARKS_WORKLOADS_HPP
+#define LOCKFREE_BENCHMARKS_WORKLOADS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "adapters.hpp"
+#include "clock.hpp"
+#include "common.hpp"
+#include "histogram.hpp"
+
+namespace bench {
+
+/*
+   Streams the requested number of elements from the producers to the
+   consumers as fast as possible, the consumers verify the sequence checksum.
+ */
+template <typename Container, typename T>
+bool RunStreaming(const Options &options, size_t producers, size_t consumers,
+                  Result &result) {
+    using A = Adapter<Container>;
+
+    const size_t batch = std::max<size_t>(options.batch, 1U);
+    const size_t elements = options.elements;
+
+    std::unique_ptr<Container> container(new Container());
+    StartBarrier barrier(producers + consumers + 1U);
+    std::atomic_size_t received_total(0U);
+    std::atomic<uint64_t> checksum(0U);
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            PinThread(options, p);
+            std::vector<T> src(batch);
+            const size_t first = elements * p / producers;
+            const size_t last = elements * (p + 1U) / producers;
+            Backoff backoff;
+
+            barrier.Wait();
+            size_t next = first;
+            while (next < last) {
+                const size_t cnt = std::min(batch, last - next);
+                for (size_t i = 0; i < cnt; i++) {
+                    src[i].seq = static_cast<uint32_t>(next + i);
+                }
+
+                size_t sent = 0;
+                while (sent < cnt) {
+                    const size_t n =
+                        A::Send(*container, src.data() + sent, cnt - sent);
+                    if (n == 0U) {
+                        backoff.Pause();
+                    }
+                    sent += n;
+                }
+                next += cnt;
+            }
+        });
+    }
+
+    for (size_t c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c]() {
+            PinThread(options, producers + c);
+            std::vector<T> dst(batch);
+            uint64_t sum = 0U;
+            Backoff backoff;
+
+            barrier.Wait();
+            while (received_total.load(std::memory_order_relaxed) < elements) {
+                const size_t n = A::Receive(*container, dst.data(), batch);
+                if (n == 0U) {
+                    backoff.Pause();
+                    continue;
+                }
+                for (size_t i = 0; i < n; i++) {
+                    sum += dst[i].seq;
+                }
+                received_total.fetch_add(n, std::memory_order_relaxed);
+            }
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+
+    barrier.Wait();
+    const auto start = std::chrono::steady_clock::now();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const double seconds = SecondsSince(start);
+
+    const uint64_t n = elements;
+    const uint64_t expected = n == 0U ? 0U : n * (n - 1U) / 2U;
+
+    result.producers = producers;
+    result.consumers = consumers;
+    result.elements = elements;
+    result.seconds = seconds;
+    result.ops_per_sec = static_cast<double>(elements) / seconds;
+    result.ns_per_op = seconds * 1e9 / static_cast<double>(elements);
+
+    return checksum.load() == expected;
+}
+
+/* Streams with as many threads as requested the container supports */
+template <typename Container, typename T>
+bool RunThroughput(const Options &options, Result &result) {
+    using A = Adapter<Container>;
+
+    return RunStreaming<Container, T>(
+        options, A::multi_producer ? options.producers : 1U,
+        A::multi_consumer ? options.consumers : 1U, result);
+}
+
+/*
+   Bounces a single element between two threads through a pair of containers,
+   the reported time per operation is half of the round trip.
+ */
+template <typename Container, typename T>
+bool RunLatency(const Options &options, Result &result) {
+    using A = Adapter<Container>;
+
+    const size_t round_trips = options.elements;
+
+    std::unique_ptr<Container> ping(new Container());
+    std::unique_ptr<Container> pong(new Container());
+    StartBarrier barrier(2U);
+    bool echo_ok = true;
+
+    std::thread echo([&]() {
+        PinThread(options, 1U);
+        T element;
+        Backoff backoff;
+
+        barrier.Wait();
+        for (size_t i = 0; i < round_trips; i++) {
+            while (A::Receive(*ping, &element, 1U) == 0U) {
+                backoff.Pause();
+            }
+            if (element.seq != static_cast<uint32_t>(i)) {
+                echo_ok = false;
+            }
+            while (A::Send(*pong, &element, 1U) == 0U) {
+                backoff.Pause();
+            }
+        }
+    });
+
+    PinThread(options, 0U);
+    T element = {};
+    bool ok = true;
+    Backoff backoff;
+
+    barrier.Wait();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < round_trips; i++) {
+        element.seq = static_cast<uint32_t>(i);
+        while (A::Send(*ping, &element, 1U) == 0U) {
+            backoff.Pause();
+        }
+        while (A::Receive(*pong, &element, 1U) == 0U) {
+            backoff.Pause();
+        }
+        if (element.seq != static_cast<uint32_t>(i)) {
+            ok = false;
+        }
+    }
+    const double seconds = SecondsSince(start);
+    echo.join();
+
+    result.producers = 1U;
+    result.consumers = 1U;
+    result.elements = round_trips;
+    result.seconds = seconds;
+    result.ops_per_sec = static_cast<double>(round_trips) / seconds;
+    result.ns_per_op = seconds * 1e9 / static_cast<double>(round_trips) / 2.0;
+
+    return ok && echo_ok;
+}
+
+/*
+   Producers push elements at a fixed offered load, stamped with the time each
+   was scheduled to be sent, and consumers record the end-to-end latency.
+   Measuring from the intended rather than the actual send time corrects for
+   coordinated omission, as a producer stalled on a full container does not
+   postpone the samples that should have been taken meanwhile. All
+   repetitions are merged into a single histogram.
+ */
+template <typename Container, typename T>
+bool RunTail(const Options &options, Result &result) {
+    using A = Adapter<Container>;
+
+    const size_t producers = A::multi_producer ? options.producers : 1U;
+    const size_t consumers = A::multi_consumer ? options.consumers : 1U;
+    const size_t batch = std::max<size_t>(options.batch, 1U);
+    const size_t elements = options.elements;
+    const double interval_ticks = static_cast<double>(producers) * 1e9 /
+                                  options.rate / options.ns_per_tick;
+
+    Histogram merged;
+    double seconds = 0.0;
+
+    for (size_t r = 0; r < options.repetitions; r++) {
+        std::unique_ptr<Container> container(new Container());
+        StartBarrier barrier(producers + consumers + 1U);
+        std::atomic_size_t received_total(0U);
+        std::vector<Histogram> histograms(consumers);
+        std::vector<std::thread> threads;
+
+        for (size_t p = 0; p < producers; p++) {
+            threads.emplace_back([&, p]() {
+                PinThread(options, p);
+                const size_t first = elements * p / producers;
+                const size_t last = elements * (p + 1U) / producers;
+                T element = {};
+                Backoff backoff;
+
+                barrier.Wait();
+                const uint64_t start = Ticks();
+                for (size_t i = first; i < last; i++) {
+                    const uint64_t intended =
+                        start + static_cast<uint64_t>(
+                                    static_cast<double>(i - first) *
+                                    interval_ticks);
+                    while (Ticks() < intended) {
+                    }
+
+                    element.stamp = options.uncorrected ? Ticks() : intended;
+                    element.seq = static_cast<uint32_t>(i);
+                    while (A::Send(*container, &element, 1U) == 0U) {
+                        backoff.Pause();
+                    }
+                }
+            });
+        }
+
+        for (size_t c = 0; c < consumers; c++) {
+            threads.emplace_back([&, c]() {
+                PinThread(options, producers + c);
+                std::vector<T> dst(batch);
+                Histogram &histogram = histograms[c];
+                Backoff backoff;
+
+                barrier.Wait();
+                while (received_total.load(std::memory_order_relaxed) <
+                       elements) {
+                    const size_t n = A::Receive(*container, dst.data(), batch);
+                    if (n == 0U) {
+                        backoff.Pause();
+                        continue;
+                    }
+                    const uint64_t now = Ticks();
+                    for (size_t i = 0; i < n; i++) {
+                        histogram.Record(
+                            now > dst[i].stamp ? now - dst[i].stamp : 0U);
+                    }
+                    received_total.fetch_add(n, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        barrier.Wait();
+        const auto start = std::chrono::steady_clock::now();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        seconds += SecondsSince(start);
+
+        for (const Histogram &histogram : histograms) {
+            merged.Merge(histogram);
+        }
+    }
+
+    const double total = static_cast<double>(elements * options.repetitions);
+
+    result.producers = producers;
+    result.consumers = consumers;
+    result.elements = elements;
+    result.seconds = seconds;
+    result.ops_per_sec = total / seconds;
+    result.ns_per_op = seconds * 1e9 / total;
+    result.percentiles.clear();
+    for (double percentile : tail_percentiles) {
+        result.percentiles.push_back(
+            static_cast<double>(merged.GetPercentile(percentile)) *
+            options.ns_per_tick);
+    }
+
+    return merged.GetCount() == elements * options.repetitions;
+}
+
+} // namespace bench
+
+#endif /* LOCKFREE_BENCHMARKS_WORKLOADS_HPP */
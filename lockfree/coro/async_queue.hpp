@@ -0,0 +1,198 @@
+/**************************************************************
+ * @file async_queue.hpp
+ * @brief A C++20 coroutine adapter for the lock-free queues,
+ * suspending instead of failing on empty and full queues.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_CORO_ASYNC_QUEUE_HPP
+#define LOCKFREE_CORO_ASYNC_QUEUE_HPP
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace coro {
+/*************************** TYPES ****************************/
+
+/* Resumes the coroutine right away on the thread that made it runnable */
+struct InlineExecutor {
+    void operator()(std::coroutine_handle<> handle) const { handle.resume(); }
+};
+
+/* Describes the queues that can be adapted */
+template <typename Queue> struct QueueTraits;
+
+template <typename T, size_t size, typename StatsPolicy>
+struct QueueTraits<spsc::Queue<T, size, StatsPolicy>> {
+    using ValueType = T;
+    static constexpr size_t capacity = size - 1U;
+};
+
+template <typename T, size_t size, typename StatsPolicy>
+struct QueueTraits<mpmc::Queue<T, size, StatsPolicy>> {
+    using ValueType = T;
+    static constexpr size_t capacity = size;
+};
+
+template <typename Queue, typename Executor = InlineExecutor>
+class AsyncQueue {
+    using T = typename QueueTraits<Queue>::ValueType;
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Waiter {
+        std::coroutine_handle<> handle;
+        Waiter *next;
+    };
+
+    /* Counts the elements or free slots, with negative values counting the
+     * coroutines waiting for them */
+    class Semaphore {
+      public:
+        explicit Semaphore(ptrdiff_t count);
+
+        bool TryAcquire();
+        bool AcquireOrWait(Waiter *waiter, Executor &executor);
+        void Release(Executor &executor);
+
+      private:
+        void Dispatch(Executor &executor);
+        bool TryTakeWake();
+
+        std::atomic<ptrdiff_t> _count; /**< Permits, negative if owed */
+        std::atomic<Waiter *> _waiters; /**< Waiting coroutine stack */
+        std::atomic_size_t _wakes; /**< Permits handed out to waiters */
+    };
+
+    /********************** PUBLIC TYPES **************************/
+  public:
+    class PopAwaiter {
+      public:
+        explicit PopAwaiter(AsyncQueue &queue);
+
+        bool await_ready();
+        bool await_suspend(std::coroutine_handle<> handle);
+        T await_resume();
+
+      private:
+        AsyncQueue &_queue;
+        Waiter _waiter;
+    };
+
+    class PushAwaiter {
+      public:
+        PushAwaiter(AsyncQueue &queue, const T &element);
+
+        bool await_ready();
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume();
+
+      private:
+        AsyncQueue &_queue;
+        Waiter _waiter;
+        T _element;
+    };
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    explicit AsyncQueue(Executor executor = Executor());
+
+    /**
+     * @brief Adds an element into the queue, suspending the calling
+     * coroutine while the queue is full. The coroutine is resumed through
+     * the executor by the side that frees a slot.
+     * @param[in] Element
+     * @retval Awaitable completing once the element was added
+     */
+    PushAwaiter PushAsync(const T &element);
+
+    /**
+     * @brief Removes an element from the queue, suspending the calling
+     * coroutine while the queue is empty. The coroutine is resumed through
+     * the executor by the side that adds an element.
+     * @retval Awaitable completing with the element
+     */
+    PopAwaiter PopAsync();
+
+    /**
+     * @brief Adds an element into the queue without suspending.
+     * Resumes a coroutine waiting in PopAsync() if there is one.
+     * @param[in] Element
+     * @retval Operation success
+     */
+    bool Push(const T &element);
+
+    /**
+     * @brief Removes an element from the queue without suspending.
+     * Resumes a coroutine waiting in PushAsync() if there is one.
+     * @param[out] Element
+     * @retval Operation success
+     */
+    bool Pop(T &element);
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    void PushAcquired(const T &element);
+    void PopAcquired(T &element);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    Queue _queue;       /**< Adapted queue */
+    Executor _executor; /**< Runs resumed coroutines */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH) Semaphore _elements; /**< For Pop */
+    alignas(LOCKFREE_CACHELINE_LENGTH) Semaphore _slots;    /**< For Push */
+#else
+    Semaphore _elements; /**< Elements available for popping */
+    Semaphore _slots;    /**< Slots available for pushing */
+#endif
+};
+
+} /* namespace coro */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "async_queue_impl.hpp"
+
+#endif
+
+#endif /* LOCKFREE_CORO_ASYNC_QUEUE_HPP */
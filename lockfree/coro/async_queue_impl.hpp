@@ -0,0 +1,270 @@
+/**************************************************************
+ * @file async_queue_impl.hpp
+ * @brief A C++20 coroutine adapter for the lock-free queues,
+ * suspending instead of failing on empty and full queues.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+namespace lockfree {
+namespace coro {
+/********************** PUBLIC METHODS ************************/
+
+template <typename Queue, typename Executor>
+AsyncQueue<Queue, Executor>::AsyncQueue(Executor executor)
+    : _executor(executor), _elements(0),
+      _slots(static_cast<ptrdiff_t>(QueueTraits<Queue>::capacity)) {}
+
+template <typename Queue, typename Executor>
+typename AsyncQueue<Queue, Executor>::PushAwaiter
+AsyncQueue<Queue, Executor>::PushAsync(const T &element) {
+    return PushAwaiter(*this, element);
+}
+
+template <typename Queue, typename Executor>
+typename AsyncQueue<Queue, Executor>::PopAwaiter
+AsyncQueue<Queue, Executor>::PopAsync() {
+    return PopAwaiter(*this);
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::Push(const T &element) {
+    if (!_slots.TryAcquire()) {
+        return false;
+    }
+
+    PushAcquired(element);
+    return true;
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::Pop(T &element) {
+    if (!_elements.TryAcquire()) {
+        return false;
+    }
+
+    PopAcquired(element);
+    return true;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename Queue, typename Executor>
+void AsyncQueue<Queue, Executor>::PushAcquired(const T &element) {
+    /* A slot is guaranteed, with multiple producers a push can only fail
+     * until a slower consumer finishes popping from it */
+    while (!_queue.Push(element)) {
+    }
+
+    _elements.Release(_executor);
+}
+
+template <typename Queue, typename Executor>
+void AsyncQueue<Queue, Executor>::PopAcquired(T &element) {
+    /* An element is guaranteed, with multiple producers a pop can only fail
+     * until a slower producer finishes pushing to it */
+    while (!_queue.Pop(element)) {
+    }
+
+    _slots.Release(_executor);
+}
+
+/************************* AWAITERS ***************************/
+
+template <typename Queue, typename Executor>
+AsyncQueue<Queue, Executor>::PopAwaiter::PopAwaiter(AsyncQueue &queue)
+    : _queue(queue), _waiter{nullptr, nullptr} {}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::PopAwaiter::await_ready() {
+    return _queue._elements.TryAcquire();
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::PopAwaiter::await_suspend(
+    std::coroutine_handle<> handle) {
+    _waiter.handle = handle;
+
+    /* The coroutine can be resumed before this returns, so the awaiter must
+     * not be accessed after the call */
+    return !_queue._elements.AcquireOrWait(&_waiter, _queue._executor);
+}
+
+template <typename Queue, typename Executor>
+typename AsyncQueue<Queue, Executor>::T
+AsyncQueue<Queue, Executor>::PopAwaiter::await_resume() {
+    T element;
+    _queue.PopAcquired(element);
+    return element;
+}
+
+template <typename Queue, typename Executor>
+AsyncQueue<Queue, Executor>::PushAwaiter::PushAwaiter(AsyncQueue &queue,
+                                                      const T &element)
+    : _queue(queue), _waiter{nullptr, nullptr}, _element(element) {}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::PushAwaiter::await_ready() {
+    return _queue._slots.TryAcquire();
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::PushAwaiter::await_suspend(
+    std::coroutine_handle<> handle) {
+    _waiter.handle = handle;
+
+    /* The coroutine can be resumed before this returns, so the awaiter must
+     * not be accessed after the call */
+    return !_queue._slots.AcquireOrWait(&_waiter, _queue._executor);
+}
+
+template <typename Queue, typename Executor>
+void AsyncQueue<Queue, Executor>::PushAwaiter::await_resume() {
+    _queue.PushAcquired(_element);
+}
+
+/************************* SEMAPHORE **************************/
+
+template <typename Queue, typename Executor>
+AsyncQueue<Queue, Executor>::Semaphore::Semaphore(const ptrdiff_t count)
+    : _count(count), _waiters(nullptr), _wakes(0U) {}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::Semaphore::TryAcquire() {
+    ptrdiff_t count = _count.load(std::memory_order_relaxed);
+
+    while (count > 0) {
+        if (_count.compare_exchange_weak(count, count - 1,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::Semaphore::AcquireOrWait(
+    Waiter *waiter, Executor &executor) {
+    if (_count.fetch_sub(1, std::memory_order_acq_rel) > 0) {
+        return true;
+    }
+
+    /* The permit is owed, a Release() will hand out a wake for it */
+    Waiter *head = _waiters.load(std::memory_order_relaxed);
+    do {
+        waiter->next = head;
+    } while (!_waiters.compare_exchange_weak(head, waiter,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed));
+
+    /* The wake could have been handed out before the waiter was visible */
+    Dispatch(executor);
+    return false;
+}
+
+template <typename Queue, typename Executor>
+void AsyncQueue<Queue, Executor>::Semaphore::Release(Executor &executor) {
+    if (_count.fetch_add(1, std::memory_order_acq_rel) < 0) {
+        _wakes.fetch_add(1U, std::memory_order_seq_cst);
+        Dispatch(executor);
+    }
+}
+
+template <typename Queue, typename Executor>
+void AsyncQueue<Queue, Executor>::Semaphore::Dispatch(Executor &executor) {
+    /*
+       Pairs wakes with waiters. Both the waiter push and the wake increment
+       are followed by a dispatch and all of these operations are sequentially
+       consistent, so at least one of the two dispatches sees both.
+     */
+    while (_wakes.load(std::memory_order_seq_cst) != 0U) {
+        Waiter *waiters = _waiters.exchange(nullptr, std::memory_order_seq_cst);
+        if (waiters == nullptr) {
+            return;
+        }
+
+        /* Taking the whole stack avoids the ABA problem of popping nodes */
+        Waiter *ready = nullptr;
+        Waiter *kept = nullptr;
+        Waiter *kept_tail = nullptr;
+        while (waiters != nullptr) {
+            Waiter *next = waiters->next;
+            if (TryTakeWake()) {
+                waiters->next = ready;
+                ready = waiters;
+            } else {
+                if (kept == nullptr) {
+                    kept_tail = waiters;
+                }
+                waiters->next = kept;
+                kept = waiters;
+            }
+            waiters = next;
+        }
+
+        /* Return the waiters without a wake before resuming anything */
+        if (kept != nullptr) {
+            Waiter *head = _waiters.load(std::memory_order_relaxed);
+            do {
+                kept_tail->next = head;
+            } while (!_waiters.compare_exchange_weak(
+                head, kept, std::memory_order_seq_cst,
+                std::memory_order_relaxed));
+        }
+
+        /* A resumed coroutine can destroy its waiter */
+        while (ready != nullptr) {
+            Waiter *next = ready->next;
+            executor(ready->handle);
+            ready = next;
+        }
+    }
+}
+
+template <typename Queue, typename Executor>
+bool AsyncQueue<Queue, Executor>::Semaphore::TryTakeWake() {
+    size_t wakes = _wakes.load(std::memory_order_seq_cst);
+
+    while (wakes > 0U) {
+        if (_wakes.compare_exchange_weak(wakes, wakes - 1U,
+                                         std::memory_order_seq_cst)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} /* namespace coro */
+} /* namespace lockfree */
@@ -0,0 +1,117 @@
+/**************************************************************
+ * @file notifier.hpp
+ * @brief An eventfd based notifier for waiting on the lock-free
+ * data structures from epoll or io_uring event loops on
+ * Linux.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_EVENT_NOTIFIER_HPP
+#define LOCKFREE_EVENT_NOTIFIER_HPP
+
+#include <atomic>
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace event {
+/*************************** TYPES ****************************/
+
+class Notifier {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    Notifier();
+    ~Notifier();
+
+    Notifier(const Notifier &) = delete;
+    Notifier &operator=(const Notifier &) = delete;
+
+    /**
+     * @brief Checks if the eventfd was created successfully.
+     * @retval Notifier validity
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Gets the eventfd to register with an event loop, it becomes
+     * readable when the consumer is notified.
+     * @retval File descriptor, negative if invalid
+     */
+    int GetFd() const;
+
+    /**
+     * @brief Notifies the consumer after data was added to the data
+     * structure. Only signals the eventfd if the consumer armed the notifier,
+     * coalescing a burst into a single system call.
+     * Should be called from the producer thread after a successful write.
+     * @retval None
+     */
+    void Notify();
+
+    /**
+     * @brief Arms the notifier before waiting on the eventfd.
+     * The data structure has to be checked again after arming, and the wait
+     * skipped if it isn't empty anymore, otherwise a wakeup can be lost.
+     * Should only be called from the consumer thread.
+     * @retval None
+     */
+    void Arm();
+
+    /**
+     * @brief Clears the eventfd after it was signaled.
+     * Should only be called from the consumer thread.
+     * @retval None
+     */
+    void Clear();
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    int _fd; /**< Eventfd file descriptor */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_bool _armed; /**< Consumer is waiting for a signal */
+#else
+    std::atomic_bool _armed; /**< Consumer is waiting for a signal */
+#endif
+};
+
+} /* namespace event */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "notifier_impl.hpp"
+
+#endif /* LOCKFREE_EVENT_NOTIFIER_HPP */
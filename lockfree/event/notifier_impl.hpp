@@ -0,0 +1,93 @@
+/**************************************************************
+ * @file notifier_impl.hpp
+ * @brief An eventfd based notifier for waiting on the lock-free
+ * data structures from epoll or io_uring event loops on
+ * Linux.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <cstdint>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace lockfree {
+namespace event {
+/********************** PUBLIC METHODS ************************/
+
+inline Notifier::Notifier()
+    : _fd(eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC)), _armed(false) {}
+
+inline Notifier::~Notifier() {
+    if (_fd >= 0) {
+        close(_fd);
+    }
+}
+
+inline bool Notifier::IsValid() const { return _fd >= 0; }
+
+inline int Notifier::GetFd() const { return _fd; }
+
+inline void Notifier::Notify() {
+    /* Orders the preceding write to the data structure before the armed flag
+     * load, pairs with the fence in Arm() */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    /* The plain load keeps the cacheline shared while the consumer is busy,
+     * only one producer gets to signal after the consumer armed */
+    if (_armed.load(std::memory_order_relaxed) &&
+        _armed.exchange(false, std::memory_order_relaxed)) {
+        const uint64_t signal = 1U;
+        ssize_t res = write(_fd, &signal, sizeof(signal));
+        (void)res;
+    }
+}
+
+inline void Notifier::Arm() {
+    _armed.store(true, std::memory_order_relaxed);
+
+    /* Orders the armed flag store before the consumer checks the data
+     * structure again, pairs with the fence in Notify() */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void Notifier::Clear() {
+    uint64_t signals;
+    ssize_t res = read(_fd, &signals, sizeof(signals));
+    (void)res;
+}
+
+} /* namespace event */
+} /* namespace lockfree */
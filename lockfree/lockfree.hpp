@@ -49,14 +49,31 @@
 #define LOCKFREE_CACHELINE_LENGTH 64U
 #endif
 
+#ifndef LOCKFREE_TRACING
+#define LOCKFREE_TRACING false
+#endif
+
 /************************** INCLUDE ***************************/
 
+#include "stats.hpp"
+
 #include "spsc/bipartite_buf.hpp"
+#include "spsc/message_buf.hpp"
 #include "spsc/priority_queue.hpp"
 #include "spsc/queue.hpp"
 #include "spsc/ring_buf.hpp"
+#include "spsc/triple_buf.hpp"
 
+#include "mpmc/delay_queue.hpp"
+#include "mpmc/hash_map.hpp"
 #include "mpmc/priority_queue.hpp"
 #include "mpmc/queue.hpp"
+#include "mpmc/sharded_queue.hpp"
+
+#include "mpsc/fan_in.hpp"
+#include "mpsc/timer_wheel.hpp"
+
+#include "spmc/broadcast_buf.hpp"
+#include "spmc/seq_lock.hpp"
 
 #endif /* LOCKFREE_HPP */
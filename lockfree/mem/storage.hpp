@@ -0,0 +1,129 @@
+/**************************************************************
+ * @file storage.hpp
+ * @brief A storage helper for placing the lock-free data
+ * structures in huge page backed, NUMA bound and prefaulted
+ * memory on Linux.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MEM_STORAGE_HPP
+#define LOCKFREE_MEM_STORAGE_HPP
+
+#include <cstddef>
+
+namespace lockfree {
+namespace mem {
+/************************* CONSTANTS **************************/
+
+/* Do not bind the storage to a NUMA node */
+constexpr int numa_node_none = -1;
+/* Bind the storage to the NUMA node of the allocating thread */
+constexpr int numa_node_local = -2;
+
+/*************************** TYPES ****************************/
+
+struct StorageConfig {
+    bool huge_pages = true; /**< Try explicit, then transparent huge pages */
+    int numa_node = numa_node_none; /**< Node to bind the storage to */
+    bool prefault = true; /**< Fault all pages in before construction */
+};
+
+struct StorageReport {
+    bool explicit_huge_pages = false; /**< Backed by MAP_HUGETLB pages */
+    bool transparent_huge_pages = false; /**< Transparent huge pages advised */
+    int numa_node = numa_node_none;      /**< Node the storage is bound to */
+    bool prefaulted = false;             /**< All pages faulted in */
+    size_t mapped_size = 0U;             /**< Size of the mapping in bytes */
+};
+
+template <typename Container> class Storage {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    Storage();
+    ~Storage();
+
+    Storage(const Storage &) = delete;
+    Storage &operator=(const Storage &) = delete;
+
+    /**
+     * @brief Maps memory according to the configuration and constructs the
+     * container in it. Huge pages and NUMA binding are best effort, what was
+     * actually obtained can be checked with GetReport().
+     * @param[in] Storage configuration
+     * @retval Operation success
+     */
+    bool Allocate(const StorageConfig &config = StorageConfig());
+
+    /**
+     * @brief Destroys the container and unmaps its memory.
+     * @retval None
+     */
+    void Free();
+
+    /**
+     * @brief Gets the container placed in the storage.
+     * @retval Pointer to the container, nullptr if not allocated
+     */
+    Container *Get() const;
+
+    /**
+     * @brief Gets the properties of the memory actually obtained.
+     * @retval Storage report
+     */
+    const StorageReport &GetReport() const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    static void *MapHuge(size_t &mapped_size);
+    static void *MapAligned(size_t size, size_t alignment);
+    static int BindToNode(void *mem, size_t mapped_size, int numa_node);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    /* The most common huge page size, on x86-64 and AArch64 */
+    static constexpr size_t _huge_page_size = 2U * 1024U * 1024U;
+
+    Container *_container; /**< Placed container, nullptr if not allocated */
+    StorageReport _report; /**< Properties of the obtained memory */
+};
+
+} /* namespace mem */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "storage_impl.hpp"
+
+#endif /* LOCKFREE_MEM_STORAGE_HPP */
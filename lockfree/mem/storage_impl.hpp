@@ -0,0 +1,225 @@
+/**************************************************************
+ * @file storage_impl.hpp
+ * @brief A storage helper for placing the lock-free data
+ * structures in huge page backed, NUMA bound and prefaulted
+ * memory on Linux.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <cstdint>
+#include <new>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace lockfree {
+namespace mem {
+/********************** PUBLIC METHODS ************************/
+
+template <typename Container>
+Storage<Container>::Storage() : _container(nullptr) {}
+
+template <typename Container> Storage<Container>::~Storage() { Free(); }
+
+template <typename Container>
+bool Storage<Container>::Allocate(const StorageConfig &config) {
+    if (_container != nullptr) {
+        return false;
+    }
+
+    StorageReport report;
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    /* Explicit huge pages come from a reserved pool and can be missing */
+    void *mem = config.huge_pages ? MapHuge(report.mapped_size) : nullptr;
+    report.explicit_huge_pages = mem != nullptr;
+
+    if (mem == nullptr) {
+        /* Transparent huge pages can only back the huge page aligned parts of
+         * a mapping, so both its start and size are aligned to them */
+        const size_t granularity =
+            config.huge_pages ? _huge_page_size : page_size;
+        report.mapped_size =
+            (sizeof(Container) + granularity - 1U) / granularity * granularity;
+
+        mem = MapAligned(report.mapped_size, granularity);
+        if (mem == nullptr) {
+            return false;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (config.huge_pages) {
+            report.transparent_huge_pages =
+                madvise(mem, report.mapped_size, MADV_HUGEPAGE) == 0;
+        }
+#endif
+    }
+
+    /* Binding has to happen before the pages are faulted in */
+    if (config.numa_node != numa_node_none) {
+        report.numa_node =
+            BindToNode(mem, report.mapped_size, config.numa_node);
+    }
+
+    if (config.prefault) {
+        volatile uint8_t *bytes = static_cast<volatile uint8_t *>(mem);
+        for (size_t offset = 0U; offset < report.mapped_size;
+             offset += page_size) {
+            bytes[offset] = 0U;
+        }
+        report.prefaulted = true;
+    }
+
+    _container = new (mem) Container();
+    _report = report;
+    return true;
+}
+
+template <typename Container> void Storage<Container>::Free() {
+    if (_container != nullptr) {
+        _container->~Container();
+        /* The container is at the aligned start of the mapping */
+        munmap(_container, _report.mapped_size);
+        _container = nullptr;
+        _report = StorageReport();
+    }
+}
+
+template <typename Container> Container *Storage<Container>::Get() const {
+    return _container;
+}
+
+template <typename Container>
+const StorageReport &Storage<Container>::GetReport() const {
+    return _report;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename Container>
+void *Storage<Container>::MapHuge(size_t &mapped_size) {
+#if defined(MAP_HUGETLB)
+    const size_t size = (sizeof(Container) + _huge_page_size - 1U) /
+                        _huge_page_size * _huge_page_size;
+
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mem != MAP_FAILED) {
+        mapped_size = size;
+        return mem;
+    }
+#else
+    (void)mapped_size;
+#endif
+
+    return nullptr;
+}
+
+template <typename Container>
+void *Storage<Container>::MapAligned(const size_t size,
+                                    const size_t alignment) {
+    /* mmap() only guarantees page alignment, so map enough to align the
+     * start, then unmap the slack on both sides */
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t slack = alignment > page_size ? alignment : 0U;
+
+    void *mem = mmap(nullptr, size + slack, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const uintptr_t start = reinterpret_cast<uintptr_t>(mem);
+    const uintptr_t aligned =
+        (start + alignment - 1U) / alignment * alignment;
+
+    const size_t head = aligned - start;
+    const size_t tail = slack - head;
+    if (head != 0U) {
+        munmap(mem, head);
+    }
+    if (tail != 0U) {
+        munmap(reinterpret_cast<void *>(aligned + size), tail);
+    }
+
+    return reinterpret_cast<void *>(aligned);
+}
+
+template <typename Container>
+int Storage<Container>::BindToNode(void *mem, const size_t mapped_size,
+                                   int numa_node) {
+#if defined(SYS_mbind) && defined(SYS_getcpu)
+    if (numa_node == numa_node_local) {
+        unsigned int cpu;
+        unsigned int node;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+            return numa_node_none;
+        }
+        numa_node = static_cast<int>(node);
+    }
+
+    /* Values from the kernel's mempolicy.h, as numaif.h is not always
+     * available */
+    constexpr int mpol_bind = 2;
+    constexpr unsigned int mpol_mf_strict = 1U << 0;
+    constexpr unsigned int mpol_mf_move = 1U << 1;
+    constexpr size_t bits_per_word = sizeof(unsigned long) * 8U;
+
+    unsigned long node_mask[1024U / bits_per_word] = {0U};
+    if (numa_node < 0 ||
+        static_cast<size_t>(numa_node) >= sizeof(node_mask) * 8U) {
+        return numa_node_none;
+    }
+    node_mask[numa_node / bits_per_word] = 1UL << (numa_node % bits_per_word);
+
+    /* The kernel expects the mask bit count plus one */
+    if (syscall(SYS_mbind, mem, mapped_size, mpol_bind, node_mask,
+                sizeof(node_mask) * 8U + 1U,
+                mpol_mf_strict | mpol_mf_move) != 0) {
+        return numa_node_none;
+    }
+
+    return numa_node;
+#else
+    (void)mem;
+    (void)mapped_size;
+    (void)numa_node;
+    return numa_node_none;
+#endif
+}
+
+} /* namespace mem */
+} /* namespace lockfree */
@@ -0,0 +1,190 @@
+/**************************************************************
+ * @file delay_queue.hpp
+ * @brief A delay queue implementation written in standard
+ * c++11 suitable for both low-end microcontrollers all the way
+ * to HPC machines. Elements become available at a deadline.
+ * Lock-free for multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPMC_DELAY_QUEUE_HPP
+#define LOCKFREE_MPMC_DELAY_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+#include "queue.hpp"
+
+namespace lockfree {
+namespace mpmc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t size, size_t bucket_count = 64U,
+          uint64_t resolution = 1U>
+class DelayQueue {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(size > 2, "Buffer size must be bigger than 2");
+    static_assert(bucket_count > 1, "Bucket count must be greater than 1");
+    static_assert((bucket_count & (bucket_count - 1)) == 0,
+                  "Bucket count must be a power of 2");
+    static_assert(bucket_count <= (size_t(1U) << 20U),
+                  "Bucket count must be at most 2^20");
+    static_assert(resolution > 0, "Resolution must be greater than 0");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    /**
+     * @brief Constructs the queue with its window starting at a point in time.
+     * Ticks are kept modulo 2^44, so the time passed to Pop() must stay
+     * within 2^43 ticks of the previous call.
+     * @param[in] now Current time, in the same unit as the deadlines
+     */
+    explicit DelayQueue(uint64_t now = 0U);
+
+    /**
+     * @brief Adds an element into the queue, available to Pop() once the
+     * deadline is reached.
+     * Can be called from any thread.
+     * @param[in] element
+     * @param[in] deadline Time the element becomes available at, rounded up
+     * to the resolution
+     * @retval Operation success, false if the bucket for the deadline is full
+     * or still holds an earlier deadline, or the deadline is more than
+     * bucket_count * resolution after the time of the latest Pop()
+     */
+    bool Push(const T &element, uint64_t deadline);
+
+    /**
+     * @brief Removes an element with a deadline that has been reached by now.
+     * Elements with earlier deadlines come first, except for elements pushed
+     * once their deadline had already been reached, which come after the
+     * other available elements.
+     * Can be called from any thread.
+     * @param[out] element
+     * @param[in] now Current time, in the same unit as the deadlines
+     * @retval Operation success, false if no element is available yet
+     */
+    bool Pop(T &element, uint64_t now);
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Removes an element with a deadline that has been reached by now,
+     * in the same order as Pop(T &, uint64_t).
+     * Can be called from any thread.
+     * @param[in] now Current time, in the same unit as the deadlines
+     * @retval Either the element or nothing if no element is available yet
+     */
+    std::optional<T> Pop(uint64_t now);
+#endif
+
+    /**
+     * @brief Estimates the number of elements in the queue, available or not,
+     * with the consistency of Queue::SizeApprox() for every bucket.
+     * @retval Element count
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if the queue holds no elements, available or not.
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    static int64_t Diff(uint64_t a, uint64_t b);
+    static uint64_t GetTick(uint64_t word);
+    static size_t GetUsers(uint64_t word);
+    static uint64_t Retagged(uint64_t word, uint64_t tick);
+
+    bool PushDue(const T &element, uint64_t tick);
+    void UpdateNow(uint64_t now_tick);
+    void MoveOn(size_t bucket, uint64_t word, uint64_t now_tick);
+    void Leave(size_t bucket, bool pushed);
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Due {
+        T element;
+        uint64_t tick; /**< Tick of the deadline */
+    };
+
+    struct Bucket {
+        Queue<T, size> queue;
+        /**
+         * Tick of the elements in the bucket in the upper bits, followed by
+         * the number of threads using the bucket and a count of pushes, so
+         * the bucket can only be given a new tick while unused and empty.
+         */
+#if LOCKFREE_CACHE_COHERENT
+        alignas(LOCKFREE_CACHELINE_LENGTH) std::atomic<uint64_t> word;
+#else
+        std::atomic<uint64_t> word;
+#endif
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _count_bits = 10U;
+    static constexpr uint64_t _count_mask = (uint64_t(1U) << _count_bits) - 1U;
+    static constexpr size_t _users_shift = _count_bits;
+    static constexpr size_t _tick_shift = 2U * _count_bits;
+    static constexpr size_t _tick_bits = 64U - _tick_shift;
+    static constexpr uint64_t _tick_mask = (uint64_t(1U) << _tick_bits) - 1U;
+
+    Queue<Due, size> _due; /**< Elements pushed after their bucket was due */
+    Bucket _buckets[bucket_count];
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic<uint64_t> _now_tick; /**< Latest tick seen by Pop() */
+#else
+    std::atomic<uint64_t> _now_tick; /**< Latest tick seen by Pop() */
+#endif
+};
+
+} /* namespace mpmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "delay_queue_impl.hpp"
+
+#endif /* LOCKFREE_MPMC_DELAY_QUEUE_HPP */
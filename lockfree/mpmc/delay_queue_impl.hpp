@@ -0,0 +1,314 @@
+/**************************************************************
+ * @file delay_queue_impl.hpp
+ * @brief A delay queue implementation written in standard
+ * c++11 suitable for both low-end microcontrollers all the way
+ * to HPC machines. Elements become available at a deadline.
+ * Lock-free for multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+namespace lockfree {
+namespace mpmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+DelayQueue<T, size, bucket_count, resolution>::DelayQueue(uint64_t now)
+    : _now_tick((now / resolution) & _tick_mask) {
+    /* Every bucket starts out holding its tick in the window after now */
+    const uint64_t first = (now / resolution) + 1U;
+    for (size_t bucket = 0U; bucket < bucket_count; bucket++) {
+        const uint64_t tick = first + ((bucket - first) & (bucket_count - 1U));
+        _buckets[bucket].word.store((tick & _tick_mask) << _tick_shift,
+                                    std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+bool DelayQueue<T, size, bucket_count, resolution>::Push(const T &element,
+                                                         uint64_t deadline) {
+    /* Round up, so an element is never available before its deadline */
+    const uint64_t tick =
+        (deadline / resolution + (deadline % resolution != 0U)) & _tick_mask;
+    const size_t bucket = tick & (bucket_count - 1U);
+
+    while (true) {
+        const uint64_t now_tick = _now_tick.load(std::memory_order_acquire);
+        if (Diff(tick, now_tick) <= 0) {
+            return PushDue(element, tick);
+        }
+        if (Diff(tick, now_tick) > int64_t(bucket_count)) {
+            /* The bucket for the tick is still in use for an earlier one */
+            return false;
+        }
+
+        uint64_t word = _buckets[bucket].word.load(std::memory_order_acquire);
+        const int64_t diff = Diff(GetTick(word), tick);
+
+        if (diff > 0) {
+            /* The bucket has moved past the tick, so it has been reached */
+            return PushDue(element, tick);
+        }
+
+        if (diff < 0) {
+            /* The bucket still holds an earlier tick, which has been reached
+             * since the window only spans bucket_count ticks. It can only be
+             * moved on once emptied. */
+            if (GetUsers(word) != 0U ||
+                !_buckets[bucket].queue.EmptyApprox()) {
+                return false;
+            }
+            _buckets[bucket].word.compare_exchange_weak(
+                word, Retagged(word, tick), std::memory_order_acq_rel,
+                std::memory_order_acquire);
+            continue;
+        }
+
+        if (GetUsers(word) == _count_mask) {
+            continue;
+        }
+
+        /* Entering on the exact word ensures the tick did not change */
+        if (_buckets[bucket].word.compare_exchange_weak(
+                word, word + (uint64_t(1U) << _users_shift),
+                std::memory_order_acq_rel, std::memory_order_acquire)) {
+            const bool result = _buckets[bucket].queue.Push(element);
+            Leave(bucket, result);
+            return result;
+        }
+    }
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+bool DelayQueue<T, size, bucket_count, resolution>::Pop(T &element,
+                                                        uint64_t now) {
+    const uint64_t now_tick = (now / resolution) & _tick_mask;
+    UpdateNow(now_tick);
+
+    /*
+       Take from the available bucket with the earliest tick. Usually that is
+       the first one from the start of the window, but a bucket still holds a
+       tick from before the window if it was not emptied in time, so the ticks
+       are compared instead of relying on the order of the buckets.
+     */
+    for (size_t attempt = 0U; attempt < bucket_count; attempt++) {
+        size_t earliest = bucket_count;
+        uint64_t earliest_word = 0U;
+        for (size_t bucket = 0U; bucket < bucket_count; bucket++) {
+            const uint64_t word =
+                _buckets[bucket].word.load(std::memory_order_acquire);
+            if (Diff(GetTick(word), now_tick) > 0) {
+                continue;
+            }
+            if (_buckets[bucket].queue.EmptyApprox()) {
+                MoveOn(bucket, word, now_tick);
+                continue;
+            }
+            if (GetUsers(word) == _count_mask) {
+                continue;
+            }
+            if (earliest == bucket_count ||
+                Diff(GetTick(word), GetTick(earliest_word)) < 0) {
+                earliest = bucket;
+                earliest_word = word;
+            }
+        }
+
+        if (earliest == bucket_count) {
+            break;
+        }
+
+        if (!_buckets[earliest].word.compare_exchange_strong(
+                earliest_word, earliest_word + (uint64_t(1U) << _users_shift),
+                std::memory_order_acq_rel, std::memory_order_acquire)) {
+            /* Contended, look again */
+            continue;
+        }
+
+        const bool result = _buckets[earliest].queue.Pop(element);
+        Leave(earliest, false);
+        if (result) {
+            return true;
+        }
+    }
+
+    /*
+       Elements pushed once their deadline had been reached come last, so
+       they can not hold back the buckets they were late for. The due queue
+       is only used while no other consumer is ahead in time, as it can hold
+       elements that are only due for that consumer.
+     */
+    Due due;
+    if (Diff(_now_tick.load(std::memory_order_acquire), now_tick) > 0 ||
+        !_due.Pop(due)) {
+        /* Could find no available elements at all */
+        return false;
+    }
+
+    if (Diff(due.tick, now_tick) > 0) {
+        /*
+           Another consumer moved ahead in time meanwhile, hand it back. Only
+           fails while pushes fill the slot this freed, and the consumer ahead
+           in time keeps taking elements out, as they are all due for it.
+         */
+        while (!_due.Push(due)) {
+        }
+        return false;
+    }
+
+    element = due.element;
+    return true;
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+size_t DelayQueue<T, size, bucket_count, resolution>::SizeApprox() const {
+    size_t count = _due.SizeApprox();
+    for (size_t bucket = 0U; bucket < bucket_count; bucket++) {
+        count += _buckets[bucket].queue.SizeApprox();
+    }
+    return count;
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+bool DelayQueue<T, size, bucket_count, resolution>::EmptyApprox() const {
+    if (!_due.EmptyApprox()) {
+        return false;
+    }
+    for (size_t bucket = 0U; bucket < bucket_count; bucket++) {
+        if (!_buckets[bucket].queue.EmptyApprox()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+std::optional<T>
+DelayQueue<T, size, bucket_count, resolution>::Pop(uint64_t now) {
+    T element;
+    bool result = Pop(element, now);
+
+    if (result) {
+        return element;
+    } else {
+        return {};
+    }
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+int64_t DelayQueue<T, size, bucket_count, resolution>::Diff(uint64_t a,
+                                                            uint64_t b) {
+    /* Ticks wrap around, so compare them by their signed distance */
+    const uint64_t diff = (a - b) & _tick_mask;
+    if (diff & (uint64_t(1U) << (_tick_bits - 1U))) {
+        return -int64_t((~diff + 1U) & _tick_mask);
+    }
+    return int64_t(diff);
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+uint64_t DelayQueue<T, size, bucket_count, resolution>::GetTick(uint64_t word) {
+    return word >> _tick_shift;
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+size_t DelayQueue<T, size, bucket_count, resolution>::GetUsers(uint64_t word) {
+    return size_t((word >> _users_shift) & _count_mask);
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+uint64_t
+DelayQueue<T, size, bucket_count, resolution>::Retagged(uint64_t word,
+                                                        uint64_t tick) {
+    /* Keeps the push count, the bucket is unused while being retagged */
+    return ((tick & _tick_mask) << _tick_shift) | (word & _count_mask);
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+bool DelayQueue<T, size, bucket_count, resolution>::PushDue(const T &element,
+                                                            uint64_t tick) {
+    const Due due = {element, tick};
+    return _due.Push(due);
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+void DelayQueue<T, size, bucket_count, resolution>::UpdateNow(
+    uint64_t now_tick) {
+    uint64_t current = _now_tick.load(std::memory_order_relaxed);
+    while (Diff(now_tick, current) > 0 &&
+           !_now_tick.compare_exchange_weak(current, now_tick,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+    }
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+void DelayQueue<T, size, bucket_count, resolution>::MoveOn(size_t bucket,
+                                                           uint64_t word,
+                                                           uint64_t now_tick) {
+    /* Move an emptied bucket on to its next tick past now_tick. The word was
+     * loaded before checking the queue, and a push completing in between
+     * changes it, failing the exchange. */
+    if (GetUsers(word) != 0U) {
+        return;
+    }
+    const uint64_t tick = GetTick(word);
+    const uint64_t rounds = uint64_t(Diff(now_tick, tick)) / bucket_count + 1U;
+    _buckets[bucket].word.compare_exchange_strong(
+        word, Retagged(word, tick + rounds * bucket_count),
+        std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+template <typename T, size_t size, size_t bucket_count, uint64_t resolution>
+void DelayQueue<T, size, bucket_count, resolution>::Leave(size_t bucket,
+                                                          bool pushed) {
+    uint64_t word = _buckets[bucket].word.load(std::memory_order_relaxed);
+    uint64_t desired;
+    do {
+        desired = word - (uint64_t(1U) << _users_shift);
+        if (pushed) {
+            /* Bump the push count so a concurrent retag sees the change */
+            desired = (desired & ~_count_mask) | ((word + 1U) & _count_mask);
+        }
+    } while (!_buckets[bucket].word.compare_exchange_weak(
+        word, desired, std::memory_order_acq_rel, std::memory_order_relaxed));
+}
+
+} /* namespace mpmc */
+} /* namespace lockfree */
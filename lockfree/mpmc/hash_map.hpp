@@ -0,0 +1,150 @@
+/**************************************************************
+ * @file hash_map.hpp
+ * @brief A bounded open addressing hash map implementation
+ * for integer keys written in standard c++11 suitable for
+ * both low-end microcontrollers all the way to HPC machines.
+ * Lock-free for multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPMC_HASH_MAP_HPP
+#define LOCKFREE_MPMC_HASH_MAP_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+namespace lockfree {
+namespace mpmc {
+/*************************** TYPES ****************************/
+
+template <typename K, typename V, size_t capacity,
+          size_t max_probe = (capacity < 64U ? capacity : 64U)>
+class HashMap {
+    static_assert(std::is_integral<K>::value, "The type K must be integral");
+    static_assert(std::is_trivial<V>::value, "The type V must be trivial");
+    static_assert(capacity > 2, "Capacity must be bigger than 2");
+    static_assert((capacity & (capacity - 1)) == 0,
+                  "Capacity must be a power of 2");
+    static_assert(max_probe > 0 && max_probe <= capacity,
+                  "Probe distance must be between 1 and the capacity");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    HashMap();
+
+    /**
+     * @brief Inserts a key and its value, if the key is not in the map yet.
+     * A key is only placed within max_probe slots of its home slot, which
+     * bounds the cost of every operation.
+     * @param[in] key
+     * @param[in] value
+     * @retval Operation success, false if the key is already in the map or
+     * every slot within max_probe of its home slot is in use
+     */
+    bool Insert(K key, const V &value);
+
+    /**
+     * @brief Finds the value of a key.
+     * @param[in] key
+     * @param[out] value
+     * @retval Whether the key was found
+     */
+    bool Find(K key, V &value) const;
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Finds the value of a key.
+     * @param[in] key
+     * @retval Either the value or nothing
+     */
+    std::optional<V> Find(K key) const;
+#endif
+
+    /**
+     * @brief Removes a key and its value.
+     * @param[in] key
+     * @retval Whether the key was found and removed
+     */
+    bool Erase(K key);
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    static size_t Hash(K key);
+    static size_t Next(size_t control, size_t state);
+    bool MatchesKey(size_t index, size_t &control, K key) const;
+    bool ResolveDuplicates(size_t home, size_t own, K key);
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    static constexpr size_t _words =
+        (sizeof(V) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+    struct Slot {
+        /**
+         * Slot state in the low bits, and a version bumped on every state
+         * change in the rest, so readers can detect the slot changing.
+         */
+        std::atomic_size_t control;
+        std::atomic<K> key;
+        std::atomic_size_t value[_words]; /**< Copied word by word */
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _state_mask = 0x07U;
+    static constexpr size_t _version_step = 0x08U;
+
+    static constexpr size_t _state_empty = 0U;    /**< Never used */
+    static constexpr size_t _state_reserved = 1U; /**< Key being written */
+    static constexpr size_t _state_pending = 2U;  /**< Checking duplicates */
+    static constexpr size_t _state_live = 3U;
+    static constexpr size_t _state_erased = 4U; /**< Tombstone */
+
+    Slot _slots[capacity];
+};
+
+} /* namespace mpmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "hash_map_impl.hpp"
+
+#endif /* LOCKFREE_MPMC_HASH_MAP_HPP */
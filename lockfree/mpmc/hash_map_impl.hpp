@@ -0,0 +1,312 @@
+/**************************************************************
+ * @file hash_map_impl.hpp
+ * @brief A bounded open addressing hash map implementation
+ * for integer keys written in standard c++11 suitable for
+ * both low-end microcontrollers all the way to HPC machines.
+ * Lock-free for multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+namespace lockfree {
+namespace mpmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+HashMap<K, V, capacity, max_probe>::HashMap() {
+    for (size_t i = 0; i < capacity; i++) {
+        _slots[i].control.store(_state_empty, std::memory_order_relaxed);
+        _slots[i].key.store(K(), std::memory_order_relaxed);
+        for (size_t j = 0; j < _words; j++) {
+            _slots[i].value[j].store(0U, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+bool HashMap<K, V, capacity, max_probe>::Insert(const K key, const V &value) {
+    const size_t home = Hash(key);
+
+    while (true) {
+        /*
+           Look for the key, and for the first reusable slot on the way. Keys
+           are never placed more than max_probe slots past their home slot, so
+           no operation has to look further, however many tombstones there are.
+         */
+        size_t candidate = capacity;
+        size_t candidate_control = 0U;
+        for (size_t i = 0; i < max_probe; i++) {
+            const size_t index = (home + i) & (capacity - 1U);
+            size_t control =
+                _slots[index].control.load(std::memory_order_acquire);
+            const size_t state = control & _state_mask;
+
+            if (state == _state_live && MatchesKey(index, control, key) &&
+                (control & _state_mask) == _state_live) {
+                return false;
+            }
+            if ((state == _state_erased || state == _state_empty) &&
+                candidate == capacity) {
+                candidate = index;
+                candidate_control = control;
+            }
+            /* The key can not be past the end of the cluster */
+            if (state == _state_empty) {
+                break;
+            }
+        }
+
+        if (candidate == capacity) {
+            return false;
+        }
+
+        Slot &slot = _slots[candidate];
+        const size_t reserved = Next(candidate_control, _state_reserved);
+        if (!slot.control.compare_exchange_strong(candidate_control, reserved,
+                                                  std::memory_order_acquire,
+                                                  std::memory_order_relaxed)) {
+            continue;
+        }
+        /*
+           Keeps the key and value stores from becoming visible before the
+           reservation, so readers validating the control word afterwards see
+           the slot being reused.
+         */
+        std::atomic_thread_fence(std::memory_order_release);
+
+        size_t words[_words] = {};
+        memcpy(words, &value, sizeof(V));
+        slot.key.store(key, std::memory_order_relaxed);
+        for (size_t i = 0; i < _words; i++) {
+            slot.value[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        /* Announce the key before checking for concurrent inserts of it */
+        const size_t pending = Next(reserved, _state_pending);
+        slot.control.store(pending, std::memory_order_seq_cst);
+
+        if (!ResolveDuplicates(home, candidate, key)) {
+            /* Fails harmlessly if another insert already erased the slot */
+            size_t expected = pending;
+            slot.control.compare_exchange_strong(
+                expected, Next(pending, _state_erased),
+                std::memory_order_release, std::memory_order_relaxed);
+            return false;
+        }
+
+        /* Fails if an insert of the same key erased the slot meanwhile */
+        size_t expected = pending;
+        return slot.control.compare_exchange_strong(
+            expected, Next(pending, _state_live), std::memory_order_release,
+            std::memory_order_relaxed);
+    }
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+bool HashMap<K, V, capacity, max_probe>::Find(const K key, V &value) const {
+    const size_t home = Hash(key);
+
+    for (size_t i = 0; i < max_probe; i++) {
+        const size_t index = (home + i) & (capacity - 1U);
+        const Slot &slot = _slots[index];
+        size_t control = slot.control.load(std::memory_order_acquire);
+
+        while (true) {
+            const size_t state = control & _state_mask;
+            if (state == _state_empty) {
+                return false;
+            }
+            if (state != _state_live || !MatchesKey(index, control, key) ||
+                (control & _state_mask) != _state_live) {
+                break;
+            }
+
+            size_t words[_words];
+            for (size_t j = 0; j < _words; j++) {
+                words[j] = slot.value[j].load(std::memory_order_relaxed);
+            }
+
+            /* The version changes if the slot was reused during the copy */
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const size_t current = slot.control.load(std::memory_order_relaxed);
+            if (current == control) {
+                memcpy(&value, words, sizeof(V));
+                return true;
+            }
+            control = slot.control.load(std::memory_order_acquire);
+        }
+    }
+
+    return false;
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+bool HashMap<K, V, capacity, max_probe>::Erase(const K key) {
+    const size_t home = Hash(key);
+
+    for (size_t i = 0; i < max_probe; i++) {
+        const size_t index = (home + i) & (capacity - 1U);
+        Slot &slot = _slots[index];
+        size_t control = slot.control.load(std::memory_order_acquire);
+
+        while (true) {
+            const size_t state = control & _state_mask;
+            if (state == _state_empty) {
+                return false;
+            }
+            if (state != _state_live || !MatchesKey(index, control, key) ||
+                (control & _state_mask) != _state_live) {
+                break;
+            }
+
+            /* The key stays behind, marking the slot as a tombstone */
+            if (slot.control.compare_exchange_weak(
+                    control, Next(control, _state_erased),
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename K, typename V, size_t capacity, size_t max_probe>
+std::optional<V> HashMap<K, V, capacity, max_probe>::Find(const K key) const {
+    V value;
+    bool result = Find(key, value);
+
+    if (result) {
+        return value;
+    } else {
+        return {};
+    }
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+size_t HashMap<K, V, capacity, max_probe>::Hash(const K key) {
+    /* Fibonacci hashing, folding the well mixed upper bits down */
+    uint64_t hash = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL;
+    hash ^= hash >> 32U;
+
+    return static_cast<size_t>(hash) & (capacity - 1U);
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+size_t HashMap<K, V, capacity, max_probe>::Next(const size_t control,
+                                                const size_t state) {
+    return ((control & ~_state_mask) + _version_step) | state;
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+bool HashMap<K, V, capacity, max_probe>::MatchesKey(const size_t index,
+                                                    size_t &control,
+                                                    const K key) const {
+    const Slot &slot = _slots[index];
+
+    /*
+       The key of a slot only changes while it is reserved, so the key is
+       valid if the control word did not change while reading it. Otherwise
+       the new control word is handed back to the caller.
+     */
+    while (true) {
+        const K slot_key = slot.key.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const size_t current = slot.control.load(std::memory_order_seq_cst);
+        if (current == control) {
+            return slot_key == key;
+        }
+
+        control = current;
+        const size_t state = control & _state_mask;
+        if (state != _state_live && state != _state_pending) {
+            return false;
+        }
+    }
+}
+
+template <typename K, typename V, size_t capacity, size_t max_probe>
+bool HashMap<K, V, capacity, max_probe>::ResolveDuplicates(const size_t home,
+                                                           const size_t own,
+                                                           const K key) {
+    /*
+       Concurrent inserts of the same key can claim different slots. Every
+       insert announces its slot before scanning the cluster, so of any two
+       such inserts at least one sees the other. The claim closest to the home
+       slot wins, erasing the others it sees, while inserts seeing a closer
+       claim or the key already live back out.
+     */
+    const size_t own_distance = (own - home) & (capacity - 1U);
+
+    for (size_t i = 0; i < max_probe; i++) {
+        const size_t index = (home + i) & (capacity - 1U);
+        if (index == own) {
+            continue;
+        }
+
+        Slot &slot = _slots[index];
+        size_t control = slot.control.load(std::memory_order_seq_cst);
+        while (true) {
+            size_t state = control & _state_mask;
+            if (state == _state_empty) {
+                return true;
+            }
+            if ((state != _state_live && state != _state_pending) ||
+                !MatchesKey(index, control, key)) {
+                break;
+            }
+
+            state = control & _state_mask;
+            if (state == _state_live || i < own_distance) {
+                return false;
+            }
+            if (slot.control.compare_exchange_weak(
+                    control, Next(control, _state_erased),
+                    std::memory_order_seq_cst)) {
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+} /* namespace mpmc */
+} /* namespace lockfree */
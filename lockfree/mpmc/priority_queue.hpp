@@ -87,6 +87,27 @@ template <typename T, size_t size, size_t priority_count> class PriorityQueue {
     std::optional<T> Pop();
 #endif
 
+    /**
+     * @brief Estimates the number of elements of all priorities in the queue.
+     * Can be called from any thread, with the consistency of
+     * Queue::SizeApprox() for every priority.
+     * @retval Element count
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if the queue holds no elements of any priority.
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /**
+     * @brief Estimates if a push with the given priority would fail.
+     * @param[in] Element priority
+     * @retval Whether the queue appears full for the priority
+     */
+    bool FullApprox(size_t priority) const;
+
     /********************** PRIVATE MEMBERS ***********************/
   private:
     Queue<T, size> _subqueue[priority_count];
@@ -44,6 +44,9 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../stats.hpp"
+#include "../trace.hpp"
+
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
 #include <optional>
 #endif
@@ -52,7 +55,8 @@ namespace lockfree {
 namespace mpmc {
 /*************************** TYPES ****************************/
 
-template <typename T, size_t size> class Queue {
+template <typename T, size_t size, typename StatsPolicy = NoStats>
+class Queue : private StatsPolicy {
     static_assert(std::is_trivial<T>::value, "The type T must be trivial");
     static_assert(size > 2, "Buffer size must be bigger than 2");
     static_assert((size & (size - 1)) == 0, "Buffer size must be a power of 2");
@@ -83,6 +87,38 @@ template <typename T, size_t size> class Queue {
     std::optional<T> Pop();
 #endif
 
+    /**
+     * @brief Reads the event counters of the queue, all zero unless the queue
+     * was instantiated with the Stats policy.
+     * Can be called from any thread.
+     * @retval Counter snapshot
+     */
+    StatsSnapshot GetStats() const;
+
+    /**
+     * @brief Estimates the number of elements in the queue.
+     * Can be called from any thread, does not synchronize with it. Pushes and
+     * pops in progress are already counted, and as the counters are read one
+     * after the other the result can be off by the operations that completed
+     * in between.
+     * @retval Element count, between 0 and size
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if the queue is empty, with the same consistency as
+     * SizeApprox().
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /**
+     * @brief Estimates if the queue is full, with the same consistency as
+     * SizeApprox().
+     * @retval Whether the queue appears full
+     */
+    bool FullApprox() const;
+
     /*********************** PRIVATE TYPES ************************/
   private:
 #if LOCKFREE_CACHE_COHERENT
@@ -40,10 +40,11 @@ namespace lockfree {
 namespace mpmc {
 /********************** PUBLIC METHODS ************************/
 
-template <typename T, size_t size>
-Queue<T, size>::Queue() : _r_count(0U), _w_count(0U) {}
+template <typename T, size_t size, typename StatsPolicy>
+Queue<T, size, StatsPolicy>::Queue() : _r_count(0U), _w_count(0U) {}
 
-template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::Push(const T &element) {
     size_t w_count = _w_count.load(std::memory_order_relaxed);
 
     while (true) {
@@ -54,6 +55,8 @@ template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
 
         /* Odd access_count means one more push than pop — the slot is full. */
         if (access_count % 2 != 0) {
+            StatsPolicy::OnPushFull();
+            LOCKFREE_TRACE(mpmc_queue_push_full, this, w_count, index);
             return false;
         }
 
@@ -69,15 +72,27 @@ template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
                 /* Advance to the next odd value — marks the slot as full */
                 _data[index].access_count.store(access_count + 1U,
                                                 std::memory_order_release);
+
+                /* Other threads may have moved both counters meanwhile, so
+                 * the count is approximate and discarded if implausible */
+                if (StatsPolicy::enabled) {
+                    const size_t count =
+                        w_count + 1U - _r_count.load(std::memory_order_relaxed);
+                    StatsPolicy::OnPushed(count <= size ? count : 0U);
+                }
+                LOCKFREE_TRACE(mpmc_queue_push, this, w_count, index);
                 return true;
             }
+            StatsPolicy::OnPushRetry();
         } else {
+            StatsPolicy::OnPushRetry();
             w_count = _w_count.load(std::memory_order_relaxed);
         }
     }
 }
 
-template <typename T, size_t size> bool Queue<T, size>::Pop(T &element) {
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::Pop(T &element) {
     size_t r_count = _r_count.load(std::memory_order_relaxed);
 
     while (true) {
@@ -88,6 +103,8 @@ template <typename T, size_t size> bool Queue<T, size>::Pop(T &element) {
 
         /* Even access_count means equal pushes and pops — the slot is empty. */
         if (access_count % 2 == 0) {
+            StatsPolicy::OnPopEmpty();
+            LOCKFREE_TRACE(mpmc_queue_pop_empty, this, r_count, index);
             return false;
         }
 
@@ -103,17 +120,55 @@ template <typename T, size_t size> bool Queue<T, size>::Pop(T &element) {
                 /* Advance to the next even value — marks the slot as empty */
                 _data[index].access_count.store(access_count + 1U,
                                                 std::memory_order_release);
+                LOCKFREE_TRACE(mpmc_queue_pop, this, r_count, index);
                 return true;
             }
+            StatsPolicy::OnPopRetry();
         } else {
+            StatsPolicy::OnPopRetry();
             r_count = _r_count.load(std::memory_order_relaxed);
         }
     }
 }
 
+template <typename T, size_t size, typename StatsPolicy>
+StatsSnapshot Queue<T, size, StatsPolicy>::GetStats() const {
+    return StatsPolicy::GetSnapshot();
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+size_t Queue<T, size, StatsPolicy>::SizeApprox() const {
+    const size_t r_count = _r_count.load(std::memory_order_relaxed);
+    const size_t w_count = _w_count.load(std::memory_order_relaxed);
+
+    /*
+       The loads are relaxed, so the read counter can be seen ahead of the
+       write counter when pops complete in between, and the write counter can
+       be more than a size ahead when pushes do. Taking the wrapped difference
+       as signed and clamping it keeps the estimate in range.
+     */
+    const std::ptrdiff_t count = static_cast<std::ptrdiff_t>(w_count - r_count);
+    if (count <= 0) {
+        return 0U;
+    }
+    return static_cast<size_t>(count) < size ? static_cast<size_t>(count)
+                                             : size;
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::EmptyApprox() const {
+    return SizeApprox() == 0U;
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::FullApprox() const {
+    return SizeApprox() == size;
+}
+
 /********************* std::optional API **********************/
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
-template <typename T, size_t size> std::optional<T> Queue<T, size>::Pop() {
+template <typename T, size_t size, typename StatsPolicy>
+std::optional<T> Queue<T, size, StatsPolicy>::Pop() {
     T element;
     bool result = Pop(element);
 
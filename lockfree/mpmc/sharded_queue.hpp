@@ -0,0 +1,142 @@
+/**************************************************************
+ * @file sharded_queue.hpp
+ * @brief A sharded queue implementation written in standard
+ * c++11, spreading threads across multiple queues to avoid
+ * contention. Lock-free for all scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPMC_SHARDED_QUEUE_HPP
+#define LOCKFREE_MPMC_SHARDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+#include "queue.hpp"
+
+namespace lockfree {
+namespace mpmc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t size, size_t shards> class ShardedQueue {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(size > 2, "Buffer size must be bigger than 2");
+    static_assert((size & (size - 1)) == 0, "Buffer size must be a power of 2");
+    static_assert(shards > 1, "Shard count must be greater than 1");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    /**
+     * @brief Adds an element into the home shard of the calling thread, or
+     * into the next shard with free space if the home shard is full.
+     * @param[in] element
+     * @retval Operation success, false only if all shards appeared full
+     */
+    bool Push(const T &element);
+
+    /**
+     * @brief Adds an element into the given shard only, for mapping
+     * producers to shards by CPU or any other criteria.
+     * @param[in] element
+     * @param[in] shard Shard index, wrapped to the shard count
+     * @retval Operation success
+     */
+    bool Push(const T &element, size_t shard);
+
+    /**
+     * @brief Removes an element from the home shard of the calling thread, or
+     * from the next shard with elements if the home shard is empty.
+     * @param[out] element
+     * @retval Operation success, false only if all shards appeared empty
+     */
+    bool Pop(T &element);
+
+    /**
+     * @brief Removes an element from the given shard first, then sweeps the
+     * others.
+     * @param[out] element
+     * @param[in] shard Shard index, wrapped to the shard count
+     * @retval Operation success
+     */
+    bool Pop(T &element, size_t shard);
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Removes an element from the home shard of the calling thread, or
+     * from the next shard with elements if the home shard is empty.
+     * @retval Either the element or nothing
+     */
+    std::optional<T> Pop();
+#endif
+
+    /**
+     * @brief Estimates the number of elements in all shards, with the
+     * consistency of Queue::SizeApprox() for every shard.
+     * @retval Element count
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if all shards are empty.
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /**
+     * @brief Gets the home shard of the calling thread. Threads are assigned
+     * home shards round robin in the order they first use a ShardedQueue of
+     * this type.
+     * @retval Shard index
+     */
+    static size_t GetHomeShard();
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    Queue<T, size> _shards[shards]; /**< Shard queues */
+};
+
+} /* namespace mpmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "sharded_queue_impl.hpp"
+
+#endif /* LOCKFREE_MPMC_SHARDED_QUEUE_HPP */
@@ -0,0 +1,133 @@
+/**************************************************************
+ * @file sharded_queue_impl.hpp
+ * @brief A sharded queue implementation written in standard
+ * c++11, spreading threads across multiple queues to avoid
+ * contention. Lock-free for all scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+namespace lockfree {
+namespace mpmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t size, size_t shards>
+bool ShardedQueue<T, size, shards>::Push(const T &element) {
+    const size_t home = GetHomeShard();
+
+    /* Overflow into the following shards, relaxing the FIFO order */
+    for (size_t i = 0; i < shards; i++) {
+        size_t shard = home + i;
+        if (shard >= shards) {
+            shard -= shards;
+        }
+        if (_shards[shard].Push(element)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, size_t size, size_t shards>
+bool ShardedQueue<T, size, shards>::Push(const T &element,
+                                         const size_t shard) {
+    return _shards[shard % shards].Push(element);
+}
+
+template <typename T, size_t size, size_t shards>
+bool ShardedQueue<T, size, shards>::Pop(T &element) {
+    return Pop(element, GetHomeShard());
+}
+
+template <typename T, size_t size, size_t shards>
+bool ShardedQueue<T, size, shards>::Pop(T &element, const size_t shard) {
+    const size_t home = shard % shards;
+
+    /* Sweep the other shards so no element is left behind */
+    for (size_t i = 0; i < shards; i++) {
+        size_t current = home + i;
+        if (current >= shards) {
+            current -= shards;
+        }
+        if (_shards[current].Pop(element)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, size_t size, size_t shards>
+size_t ShardedQueue<T, size, shards>::SizeApprox() const {
+    size_t count = 0U;
+    for (size_t shard = 0U; shard < shards; shard++) {
+        count += _shards[shard].SizeApprox();
+    }
+    return count;
+}
+
+template <typename T, size_t size, size_t shards>
+bool ShardedQueue<T, size, shards>::EmptyApprox() const {
+    for (size_t shard = 0U; shard < shards; shard++) {
+        if (!_shards[shard].EmptyApprox()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, size_t size, size_t shards>
+size_t ShardedQueue<T, size, shards>::GetHomeShard() {
+    static std::atomic_size_t next_home(0U);
+    thread_local const size_t home =
+        next_home.fetch_add(1U, std::memory_order_relaxed) % shards;
+    return home;
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename T, size_t size, size_t shards>
+std::optional<T> ShardedQueue<T, size, shards>::Pop() {
+    T element;
+    bool result = Pop(element);
+
+    if (result) {
+        return element;
+    } else {
+        return {};
+    }
+}
+#endif
+
+} /* namespace mpmc */
+} /* namespace lockfree */
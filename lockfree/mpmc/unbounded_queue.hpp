@@ -0,0 +1,197 @@
+/**************************************************************
+ * @file unbounded_queue.hpp
+ * @brief An unbounded queue implementation written in standard
+ * c++11 built from linked, recycled segments. Lock-free for
+ * multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPMC_UNBOUNDED_QUEUE_HPP
+#define LOCKFREE_MPMC_UNBOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+#include "../reclaim/hazard_pointers.hpp"
+#include "queue.hpp"
+
+namespace lockfree {
+namespace mpmc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size = 4U>
+class UnboundedQueue {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(segment_size > 2, "Segment size must be bigger than 2");
+    static_assert(max_threads > 0, "There must be at least one thread");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    UnboundedQueue();
+
+    /**
+     * @brief Frees all segments. No thread may use the queue anymore.
+     */
+    ~UnboundedQueue();
+
+    UnboundedQueue(const UnboundedQueue &) = delete;
+    UnboundedQueue &operator=(const UnboundedQueue &) = delete;
+
+    /**
+     * @brief Claims a thread slot, used to protect the segments the thread
+     * accesses from being recycled.
+     * Can be called from any thread.
+     * @param[out] thread Thread index to pass to Push() and Pop()
+     * @retval Operation success, false if all slots are taken
+     */
+    bool Register(size_t &thread);
+
+    /**
+     * @brief Releases a thread slot.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     */
+    void Unregister(size_t thread);
+
+    /**
+     * @brief Adds an element into the queue, linking in a new segment when
+     * the last one is full.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] element
+     * @retval Operation success, false only if a segment could not be
+     * allocated
+     */
+    bool Push(size_t thread, const T &element);
+
+    /**
+     * @brief Removes an element from the queue.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[out] element
+     * @retval Operation success
+     */
+    bool Pop(size_t thread, T &element);
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Removes an element from the queue.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @retval Either the element or nothing
+     */
+    std::optional<T> Pop(size_t thread);
+#endif
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Slot {
+#else
+    struct Slot {
+#endif
+        T val;
+        /**
+         * Counts all pushes and pops performed on this slot, as in Queue.
+         * Every slot is used once per segment generation, so the generation
+         * takes the place of the revolution:
+         * 2*G - EMPTY, ready for the push of generation G.
+         * 2*G+1 - FULL, ready for the pop of generation G.
+         */
+        std::atomic_size_t access_count;
+
+        Slot() : access_count(0U) {}
+    };
+
+    struct Segment {
+        Slot slots[segment_size];
+#if LOCKFREE_CACHE_COHERENT
+        alignas(LOCKFREE_CACHELINE_LENGTH)
+            std::atomic_size_t w_count; /**< Pushes claimed */
+        alignas(LOCKFREE_CACHELINE_LENGTH)
+            std::atomic_size_t r_count; /**< Pops claimed */
+        alignas(LOCKFREE_CACHELINE_LENGTH) std::atomic<Segment *> next;
+#else
+        std::atomic_size_t w_count; /**< Pushes claimed */
+        std::atomic_size_t r_count; /**< Pops claimed */
+        std::atomic<Segment *> next;
+#endif
+        size_t generation; /**< Times the segment has been recycled */
+        void *memory;      /**< Allocation, nullptr for the first segment */
+        UnboundedQueue *owner;
+
+        Segment() : w_count(0U), r_count(0U), next(nullptr), generation(0U) {}
+    };
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    Segment *Allocate();
+    void Recycle(Segment *segment);
+    void Retire(size_t thread, Segment *segment);
+
+    static void Free(Segment *segment);
+    static void OnReclaimed(void *ptr);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    Segment _first; /**< Embedded, so construction cannot fail */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic<Segment *> _head; /**< Segment being popped from */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic<Segment *> _tail; /**< Segment being pushed to */
+#else
+    std::atomic<Segment *> _head; /**< Segment being popped from */
+    std::atomic<Segment *> _tail; /**< Segment being pushed to */
+#endif
+    Queue<Segment *, pool_size> _pool; /**< Drained segments for reuse */
+    bool _destroying; /**< Frees reclaimed segments instead of pooling */
+    reclaim::HazardPointers<max_threads, 1U, max_threads + 1U> _hp;
+};
+
+} /* namespace mpmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "unbounded_queue_impl.hpp"
+
+#endif /* LOCKFREE_MPMC_UNBOUNDED_QUEUE_HPP */
@@ -0,0 +1,284 @@
+/**************************************************************
+ * @file unbounded_queue_impl.hpp
+ * @brief An unbounded queue implementation written in standard
+ * c++11 built from linked, recycled segments. Lock-free for
+ * multi-producer multi-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <cstdint>
+#include <new>
+
+namespace lockfree {
+namespace mpmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+UnboundedQueue<T, segment_size, max_threads, pool_size>::UnboundedQueue()
+    : _head(&_first), _tail(&_first), _destroying(false) {
+    _first.memory = nullptr;
+    _first.owner = this;
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+UnboundedQueue<T, segment_size, max_threads, pool_size>::~UnboundedQueue() {
+    /* Segments still pending reclamation are freed by _hp */
+    _destroying = true;
+
+    Segment *segment = _head.load(std::memory_order_relaxed);
+    while (segment != nullptr) {
+        Segment *next = segment->next.load(std::memory_order_relaxed);
+        Free(segment);
+        segment = next;
+    }
+
+    while (_pool.Pop(segment)) {
+        Free(segment);
+    }
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+bool UnboundedQueue<T, segment_size, max_threads, pool_size>::Register(
+    size_t &thread) {
+    return _hp.Register(thread);
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+void UnboundedQueue<T, segment_size, max_threads, pool_size>::Unregister(
+    size_t thread) {
+    _hp.Unregister(thread);
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+bool UnboundedQueue<T, segment_size, max_threads, pool_size>::Push(
+    size_t thread, const T &element) {
+    while (true) {
+        Segment *segment = _hp.Protect(thread, 0U, _tail);
+
+        /* Slots are never reused within a generation, so claiming one can't
+         * fail. Claims past the end close the segment for good. */
+        const size_t w_count =
+            segment->w_count.fetch_add(1U, std::memory_order_relaxed);
+        if (w_count < segment_size) {
+            Slot &slot = segment->slots[w_count];
+            slot.val = element;
+            /* Advance to the next odd value — marks the slot as full */
+            slot.access_count.store(2U * segment->generation + 1U,
+                                    std::memory_order_release);
+            _hp.Clear(thread, 0U);
+            return true;
+        }
+
+        Segment *next = segment->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            Segment *const fresh = Allocate();
+            if (fresh == nullptr) {
+                _hp.Clear(thread, 0U);
+                return false;
+            }
+
+            if (segment->next.compare_exchange_strong(
+                    next, fresh, std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+                next = fresh;
+            } else {
+                /* Another producer linked a segment first */
+                Recycle(fresh);
+            }
+        }
+
+        /* Help move the tail on, whoever linked the segment */
+        _tail.compare_exchange_strong(segment, next, std::memory_order_acq_rel,
+                                      std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+bool UnboundedQueue<T, segment_size, max_threads, pool_size>::Pop(
+    size_t thread, T &element) {
+    while (true) {
+        Segment *segment = _hp.Protect(thread, 0U, _head);
+        const size_t full = 2U * segment->generation + 1U;
+        size_t r_count = segment->r_count.load(std::memory_order_relaxed);
+
+        while (r_count < segment_size) {
+            Slot &slot = segment->slots[r_count];
+            const size_t access_count =
+                slot.access_count.load(std::memory_order_acquire);
+
+            /* Not pushed yet, or the push is still in progress */
+            if (access_count == full - 1U) {
+                _hp.Clear(thread, 0U);
+                return false;
+            }
+
+            /* Popped already, the read counter moved on meanwhile */
+            if (access_count != full) {
+                r_count = segment->r_count.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (segment->r_count.compare_exchange_weak(
+                    r_count, r_count + 1U, std::memory_order_relaxed)) {
+                element = slot.val;
+                /* Advance to the next even value — marks the slot as empty */
+                slot.access_count.store(full + 1U, std::memory_order_release);
+                _hp.Clear(thread, 0U);
+                return true;
+            }
+        }
+
+        /* Every slot of the segment has been popped, move on if possible */
+        Segment *next = segment->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            _hp.Clear(thread, 0U);
+            return false;
+        }
+
+        if (_head.compare_exchange_strong(segment, next,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+            /* The tail can lag behind, it must not point to a retired
+             * segment */
+            Segment *tail = segment;
+            _tail.compare_exchange_strong(tail, next,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed);
+            _hp.Clear(thread, 0U);
+            Retire(thread, segment);
+        }
+    }
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+std::optional<T>
+UnboundedQueue<T, segment_size, max_threads, pool_size>::Pop(size_t thread) {
+    T element;
+    bool result = Pop(thread, element);
+
+    if (result) {
+        return element;
+    } else {
+        return {};
+    }
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+typename UnboundedQueue<T, segment_size, max_threads, pool_size>::Segment *
+UnboundedQueue<T, segment_size, max_threads, pool_size>::Allocate() {
+    Segment *segment = nullptr;
+    if (_pool.Pop(segment)) {
+        /* Nobody else references a pooled segment */
+        segment->w_count.store(0U, std::memory_order_relaxed);
+        segment->r_count.store(0U, std::memory_order_relaxed);
+        segment->next.store(nullptr, std::memory_order_relaxed);
+        return segment;
+    }
+
+    /* Align manually, as operator new ignores over-alignment before C++17 */
+    const size_t alignment = alignof(Segment);
+    void *const memory =
+        ::operator new(sizeof(Segment) + alignment - 1U, std::nothrow);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    const uintptr_t address =
+        (reinterpret_cast<uintptr_t>(memory) + alignment - 1U) &
+        ~uintptr_t(alignment - 1U);
+
+    segment = new (reinterpret_cast<void *>(address)) Segment();
+    segment->memory = memory;
+    segment->owner = this;
+    return segment;
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+void UnboundedQueue<T, segment_size, max_threads, pool_size>::Recycle(
+    Segment *segment) {
+    if (_destroying || !_pool.Push(segment)) {
+        Free(segment);
+    }
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+void UnboundedQueue<T, segment_size, max_threads, pool_size>::Retire(
+    size_t thread, Segment *segment) {
+    _hp.Retire(thread, segment, OnReclaimed);
+    /* A scan per drained segment is cheap compared to segment_size pops and
+     * gets segments back into the pool right away */
+    _hp.Reclaim(thread);
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+void UnboundedQueue<T, segment_size, max_threads, pool_size>::Free(
+    Segment *segment) {
+    void *const memory = segment->memory;
+    if (memory == nullptr) {
+        /* The first segment is embedded in the queue */
+        return;
+    }
+    segment->~Segment();
+    ::operator delete(memory);
+}
+
+template <typename T, size_t segment_size, size_t max_threads,
+          size_t pool_size>
+void UnboundedQueue<T, segment_size, max_threads, pool_size>::OnReclaimed(
+    void *ptr) {
+    Segment *const segment = static_cast<Segment *>(ptr);
+    /* Every slot has been pushed and popped once, moving them all on to the
+     * empty state of the next generation */
+    segment->generation++;
+    segment->owner->Recycle(segment);
+}
+
+} /* namespace mpmc */
+} /* namespace lockfree */
@@ -0,0 +1,160 @@
+/**************************************************************
+ * @file fan_in.hpp
+ * @brief A multi-producer single-consumer fan-in built from
+ * single-producer single-consumer queues, written in
+ * standard c++11. Wait-free for producers.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPSC_FAN_IN_HPP
+#define LOCKFREE_MPSC_FAN_IN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+#include "../spsc/queue.hpp"
+
+namespace lockfree {
+namespace mpsc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t size, size_t max_producers> class FanIn {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(size > 2, "Buffer size must be bigger than 2");
+    static_assert(max_producers > 0, "There must be at least one producer");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    FanIn();
+
+    /**
+     * @brief Claims a producer slot, which owns its own queue.
+     * Can be called from any thread.
+     * @param[out] producer Producer index to pass to Push()
+     * @retval Operation success, false if all slots are taken
+     */
+    bool Register(size_t &producer);
+
+    /**
+     * @brief Releases a producer slot. The slot can be claimed again once the
+     * consumer has drained all of its elements.
+     * Should only be called from the producer thread owning the slot.
+     * @param[in] producer Producer index
+     */
+    void Unregister(size_t producer);
+
+    /**
+     * @brief Adds an element into the queue of a producer.
+     * Should only be called from the producer thread owning the slot.
+     * @param[in] producer Producer index
+     * @param[in] element
+     * @retval Operation success, false if the producer queue is full
+     */
+    bool Push(size_t producer, const T &element);
+
+    /**
+     * @brief Removes an element, visiting producers with elements round
+     * robin.
+     * Should only be called from the consumer thread.
+     * @param[out] element
+     * @retval Operation success
+     */
+    bool Pop(T &element);
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Removes an element, visiting producers with elements round
+     * robin.
+     * Should only be called from the consumer thread.
+     * @retval Either the element or nothing
+     */
+    std::optional<T> Pop();
+#endif
+
+    /**
+     * @brief Removes up to cnt elements, taking up to per_producer elements
+     * from each producer with elements in turn.
+     * Should only be called from the consumer thread.
+     * @param[out] data Pointer to memory to store the elements in
+     * @param[in] cnt Maximum number of elements to remove
+     * @param[in] per_producer Maximum number of elements to take from a
+     * producer before moving on to the next one
+     * @retval Number of elements removed
+     */
+    size_t PopBatch(T *data, size_t cnt, size_t per_producer);
+
+    /********************** PRIVATE METHODS ***********************/
+  private:
+    void CollectReady();
+    void OnDrained(size_t producer);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr uint8_t _slot_free = 0U;
+    static constexpr uint8_t _slot_active = 1U;
+    static constexpr uint8_t _slot_retiring = 2U; /**< Waiting to be drained */
+
+    static constexpr size_t _word_bits = sizeof(size_t) * 8U;
+    static constexpr size_t _words =
+        (max_producers + _word_bits - 1U) / _word_bits;
+
+    spsc::Queue<T, size> _queues[max_producers]; /**< Producer queues */
+    std::atomic<uint8_t> _states[max_producers]; /**< Slot states */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _ready[_words]; /**< Producers with new elements */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        size_t _pending[_words]; /**< Producers the consumer has yet to drain */
+#else
+    std::atomic_size_t _ready[_words]; /**< Producers with new elements */
+    size_t _pending[_words]; /**< Producers the consumer has yet to drain */
+#endif
+    size_t _cursor; /**< Next producer the consumer visits */
+};
+
+} /* namespace mpsc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "fan_in_impl.hpp"
+
+#endif /* LOCKFREE_MPSC_FAN_IN_HPP */
@@ -0,0 +1,197 @@
+/**************************************************************
+ * @file fan_in_impl.hpp
+ * @brief A multi-producer single-consumer fan-in built from
+ * single-producer single-consumer queues, written in
+ * standard c++11. Wait-free for producers.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <algorithm>
+#include <cassert>
+
+namespace lockfree {
+namespace mpsc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t size, size_t max_producers>
+FanIn<T, size, max_producers>::FanIn() : _cursor(0U) {
+    for (size_t i = 0; i < max_producers; i++) {
+        _states[i].store(_slot_free, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < _words; i++) {
+        _ready[i].store(0U, std::memory_order_relaxed);
+        _pending[i] = 0U;
+    }
+}
+
+template <typename T, size_t size, size_t max_producers>
+bool FanIn<T, size, max_producers>::Register(size_t &producer) {
+    for (size_t i = 0; i < max_producers; i++) {
+        uint8_t state = _slot_free;
+        /* Acquire pairs with the consumer freeing the slot once drained */
+        if (_states[i].compare_exchange_strong(state, _slot_active,
+                                               std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+            producer = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, size_t size, size_t max_producers>
+void FanIn<T, size, max_producers>::Unregister(const size_t producer) {
+    assert(producer < max_producers);
+
+    _states[producer].store(_slot_retiring, std::memory_order_release);
+
+    /* Make the consumer visit the slot even if it has no elements left */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    _ready[producer / _word_bits].fetch_or(size_t(1U)
+                                               << (producer % _word_bits),
+                                           std::memory_order_relaxed);
+}
+
+template <typename T, size_t size, size_t max_producers>
+bool FanIn<T, size, max_producers>::Push(const size_t producer,
+                                         const T &element) {
+    assert(producer < max_producers);
+
+    if (!_queues[producer].Push(element)) {
+        return false;
+    }
+
+    /*
+       The fence orders the push before the check of the ready bit, pairing
+       with the fence after the consumer collects the ready bits. Either the
+       consumer sees the element after collecting, or this sees the bit
+       cleared and sets it again. The bit is only written when it is clear,
+       so a busy producer mostly just reads it.
+     */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::atomic_size_t &ready = _ready[producer / _word_bits];
+    const size_t mask = size_t(1U) << (producer % _word_bits);
+    if ((ready.load(std::memory_order_relaxed) & mask) == 0U) {
+        ready.fetch_or(mask, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+template <typename T, size_t size, size_t max_producers>
+bool FanIn<T, size, max_producers>::Pop(T &element) {
+    return PopBatch(&element, 1U, 1U) == 1U;
+}
+
+template <typename T, size_t size, size_t max_producers>
+size_t FanIn<T, size, max_producers>::PopBatch(T *data, const size_t cnt,
+                                               const size_t per_producer) {
+    assert(per_producer > 0U);
+
+    CollectReady();
+
+    size_t total = 0U;
+    for (size_t visited = 0U; visited < max_producers && total < cnt;
+         visited++) {
+        const size_t producer = _cursor;
+        _cursor = (_cursor + 1U == max_producers) ? 0U : _cursor + 1U;
+
+        const size_t word = producer / _word_bits;
+        const size_t mask = size_t(1U) << (producer % _word_bits);
+        if ((_pending[word] & mask) == 0U) {
+            continue;
+        }
+
+        const size_t wanted = std::min(per_producer, cnt - total);
+        size_t taken = 0U;
+        while (taken < wanted && _queues[producer].Pop(data[total])) {
+            taken++;
+            total++;
+        }
+
+        /* Stop visiting the producer only once its queue was seen empty */
+        if (taken < wanted) {
+            _pending[word] &= ~mask;
+            OnDrained(producer);
+        }
+    }
+
+    return total;
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename T, size_t size, size_t max_producers>
+std::optional<T> FanIn<T, size, max_producers>::Pop() {
+    T element;
+    bool result = Pop(element);
+
+    if (result) {
+        return element;
+    } else {
+        return {};
+    }
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t size, size_t max_producers>
+void FanIn<T, size, max_producers>::CollectReady() {
+    bool collected = false;
+    for (size_t i = 0; i < _words; i++) {
+        /* Only take ownership of the bits when there are any */
+        if (_ready[i].load(std::memory_order_relaxed) != 0U) {
+            _pending[i] |= _ready[i].exchange(0U, std::memory_order_relaxed);
+            collected = true;
+        }
+    }
+
+    if (collected) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+template <typename T, size_t size, size_t max_producers>
+void FanIn<T, size, max_producers>::OnDrained(const size_t producer) {
+    /* A retiring producer pushes nothing more, so its slot can be reused */
+    if (_states[producer].load(std::memory_order_acquire) == _slot_retiring) {
+        _states[producer].store(_slot_free, std::memory_order_release);
+    }
+}
+
+} /* namespace mpsc */
+} /* namespace lockfree */
@@ -0,0 +1,177 @@
+/**************************************************************
+ * @file timer_wheel.hpp
+ * @brief A hierarchical timer wheel written in standard c++11,
+ * where any thread can schedule and cancel timers, while a
+ * single owner thread advances time. Lock-free for
+ * multi-producer single-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MPSC_TIMER_WHEEL_HPP
+#define LOCKFREE_MPSC_TIMER_WHEEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../mpmc/queue.hpp"
+#include "../spsc/ring_buf.hpp"
+
+namespace lockfree {
+namespace mpsc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+class TimerWheel {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(max_timers > 2, "There must be more than 2 timers");
+    static_assert((max_timers & (max_timers - 1)) == 0,
+                  "The number of timers must be a power of 2");
+    static_assert(max_timers <= 0xFFFFFFFFU, "Too many timers");
+
+    /*********************** PUBLIC TYPES *************************/
+  public:
+    /**
+     * An expired timer, written to the expired ring buffer.
+     */
+    struct Expiration {
+        uint64_t handle; /**< Handle returned by Schedule() */
+        T data;          /**< Data passed to Schedule() */
+    };
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    TimerWheel();
+
+    /**
+     * @brief Schedules a timer. The timer expires during the first Advance()
+     * reaching the deadline.
+     * Can be called from any thread.
+     * @param[in] deadline Tick to expire at, in the same unit as Advance()
+     * @param[in] data Data to pass along with the expiration
+     * @param[out] handle Handle of the timer, for cancelling it
+     * @retval Operation success, false if all timers are in use or the intake
+     * is full
+     */
+    bool Schedule(uint64_t deadline, const T &data, uint64_t &handle);
+
+    /**
+     * @brief Cancels a timer, if it has not expired yet by the time the owner
+     * thread processes the cancellation.
+     * Can be called from any thread.
+     * @param[in] handle Handle returned by Schedule()
+     * @retval Operation success, false if the intake is full
+     */
+    bool Cancel(uint64_t handle);
+
+    /**
+     * @brief Processes scheduled and cancelled timers, and advances time,
+     * writing the expired timers to the expired ring buffer.
+     * Should only be called from the owner thread.
+     * @param[in] now Current tick, never going back in time
+     * @retval Number of timers written to the expired ring buffer
+     */
+    size_t Advance(uint64_t now);
+
+    /**
+     * @brief Gets the ring buffer the expired timers are written to. Timers
+     * expiring while it is full are written during the next Advance().
+     * The owner thread is the producer of the ring buffer.
+     * @retval Expired ring buffer
+     */
+    spsc::RingBuf<Expiration, expired_size> &GetExpired();
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Command {
+        uint64_t handle;
+        bool cancel; /**< Cancels the timer instead of scheduling it */
+    };
+
+    struct Node {
+        T data;
+        uint64_t deadline;
+        uint64_t handle; /**< Handle of the scheduled timer, owner only */
+        size_t prev;
+        size_t next;
+        size_t bucket; /**< Wheel bucket linked into, or _unlinked */
+    };
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    void Apply(const Command &command);
+    void Insert(size_t index);
+    void Link(size_t index, size_t bucket);
+    void Unlink(size_t index);
+    void Tick();
+    void Cascade(size_t level);
+    void Expire(size_t index);
+    void FlushPending();
+    void Free(size_t index);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _levels = 4U;
+    static constexpr size_t _slot_bits = 6U;
+    static constexpr size_t _slots = size_t(1U) << _slot_bits;
+    static constexpr size_t _buckets = _levels * _slots;
+    /** Furthest tick a timer can be placed at, later ones are re-placed */
+    static constexpr uint64_t _range = uint64_t(1U)
+                                       << (_levels * _slot_bits);
+    static constexpr size_t _none = ~size_t(0);
+    static constexpr size_t _unlinked = _buckets;
+
+    mpmc::Queue<uint64_t, max_timers> _free;     /**< Free timer handles */
+    mpmc::Queue<Command, intake_size> _intake;   /**< Commands to the owner */
+    spsc::RingBuf<Expiration, expired_size> _expired; /**< Expired timers */
+
+    Node _nodes[max_timers];
+    size_t _heads[_buckets]; /**< Timers of every slot of every level */
+    size_t _pending_head;    /**< Expired timers not yet written */
+    size_t _pending_tail;
+    uint64_t _now;    /**< Last tick processed */
+    size_t _active;   /**< Timers linked into the wheel */
+    size_t _expiring; /**< Timers expired during the current Advance() */
+};
+
+} /* namespace mpsc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "timer_wheel_impl.hpp"
+
+#endif /* LOCKFREE_MPSC_TIMER_WHEEL_HPP */
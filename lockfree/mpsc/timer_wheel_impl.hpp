@@ -0,0 +1,321 @@
+/**************************************************************
+ * @file timer_wheel_impl.hpp
+ * @brief A hierarchical timer wheel written in standard c++11,
+ * where any thread can schedule and cancel timers, while a
+ * single owner thread advances time. Lock-free for
+ * multi-producer single-consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+namespace lockfree {
+namespace mpsc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+TimerWheel<T, max_timers, intake_size, expired_size>::TimerWheel()
+    : _pending_head(_none), _pending_tail(_none), _now(0U), _active(0U),
+      _expiring(0U) {
+    for (size_t i = 0; i < max_timers; i++) {
+        _nodes[i].handle = i;
+        _nodes[i].prev = _none;
+        _nodes[i].next = _none;
+        _nodes[i].bucket = _unlinked;
+        _free.Push(i);
+    }
+    for (size_t i = 0; i < _buckets; i++) {
+        _heads[i] = _none;
+    }
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+bool TimerWheel<T, max_timers, intake_size, expired_size>::Schedule(
+    const uint64_t deadline, const T &data, uint64_t &handle) {
+    uint64_t free_handle = 0U;
+    if (!_free.Pop(free_handle)) {
+        return false;
+    }
+
+    /* The timer belongs to this thread until the owner gets the command */
+    Node &node = _nodes[free_handle & 0xFFFFFFFFU];
+    node.data = data;
+    node.deadline = deadline;
+
+    const Command command = {free_handle, false};
+    if (!_intake.Push(command)) {
+        /* Only fails while a pop of the free queue is still in progress */
+        while (!_free.Push(free_handle)) {
+        }
+        return false;
+    }
+
+    handle = free_handle;
+    return true;
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+bool TimerWheel<T, max_timers, intake_size, expired_size>::Cancel(
+    const uint64_t handle) {
+    const Command command = {handle, true};
+    return _intake.Push(command);
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+size_t TimerWheel<T, max_timers, intake_size, expired_size>::Advance(
+    const uint64_t now) {
+    _expiring = 0U;
+
+    /* Timers that did not fit last time go first, keeping the order */
+    FlushPending();
+
+    Command command;
+    while (_intake.Pop(command)) {
+        Apply(command);
+    }
+
+    while (_now < now) {
+        /* An empty wheel has nothing to cascade or expire */
+        if (_active == 0U) {
+            _now = now;
+            break;
+        }
+        Tick();
+    }
+
+    return _expiring;
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+spsc::RingBuf<typename TimerWheel<T, max_timers, intake_size,
+                                  expired_size>::Expiration,
+              expired_size> &
+TimerWheel<T, max_timers, intake_size, expired_size>::GetExpired() {
+    return _expired;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Apply(
+    const Command &command) {
+    const size_t index = command.handle & 0xFFFFFFFFU;
+    Node &node = _nodes[index];
+
+    if (!command.cancel) {
+        node.handle = command.handle;
+        Insert(index);
+        return;
+    }
+
+    /* The timer may have expired, or its slot been reused, meanwhile */
+    if (node.handle == command.handle && node.bucket != _unlinked) {
+        Unlink(index);
+        Free(index);
+    }
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Insert(
+    const size_t index) {
+    const Node &node = _nodes[index];
+    if (node.deadline <= _now) {
+        Expire(index);
+        return;
+    }
+
+    /* Timers past the range wait in the last slot and are placed again */
+    uint64_t delta = node.deadline - _now;
+    if (delta >= _range) {
+        delta = _range - 1U;
+    }
+    const uint64_t deadline = _now + delta;
+
+    /* Every level covers the range of all the levels below it per slot */
+    size_t level = 0U;
+    while (level < _levels - 1U &&
+           delta >= (uint64_t(1U) << ((level + 1U) * _slot_bits))) {
+        level++;
+    }
+    const size_t slot =
+        static_cast<size_t>(deadline >> (level * _slot_bits)) & (_slots - 1U);
+
+    Link(index, level * _slots + slot);
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Link(
+    const size_t index, const size_t bucket) {
+    Node &node = _nodes[index];
+
+    node.prev = _none;
+    node.next = _heads[bucket];
+    if (node.next != _none) {
+        _nodes[node.next].prev = index;
+    }
+    _heads[bucket] = index;
+    node.bucket = bucket;
+
+    _active++;
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Unlink(
+    const size_t index) {
+    Node &node = _nodes[index];
+
+    if (node.prev != _none) {
+        _nodes[node.prev].next = node.next;
+    } else {
+        _heads[node.bucket] = node.next;
+    }
+    if (node.next != _none) {
+        _nodes[node.next].prev = node.prev;
+    }
+    node.bucket = _unlinked;
+
+    _active--;
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Tick() {
+    _now++;
+
+    /* Move the timers of higher levels down as their slot comes up */
+    for (size_t level = _levels - 1U; level > 0U; level--) {
+        const uint64_t mask = (uint64_t(1U) << (level * _slot_bits)) - 1U;
+        if ((_now & mask) == 0U) {
+            Cascade(level);
+        }
+    }
+
+    /* Every timer in the current slot of the lowest level is due */
+    const size_t bucket = static_cast<size_t>(_now) & (_slots - 1U);
+    size_t index = _heads[bucket];
+    _heads[bucket] = _none;
+    while (index != _none) {
+        const size_t next = _nodes[index].next;
+        _nodes[index].bucket = _unlinked;
+        _active--;
+        Expire(index);
+        index = next;
+    }
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Cascade(
+    const size_t level) {
+    const size_t slot =
+        static_cast<size_t>(_now >> (level * _slot_bits)) & (_slots - 1U);
+    const size_t bucket = level * _slots + slot;
+
+    size_t index = _heads[bucket];
+    _heads[bucket] = _none;
+    while (index != _none) {
+        const size_t next = _nodes[index].next;
+        _nodes[index].bucket = _unlinked;
+        _active--;
+        Insert(index);
+        index = next;
+    }
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Expire(
+    const size_t index) {
+    Node &node = _nodes[index];
+
+    if (_pending_head == _none) {
+        const Expiration expiration = {node.handle, node.data};
+        if (_expired.Write(&expiration, 1U)) {
+            _expiring++;
+            Free(index);
+            return;
+        }
+    }
+
+    /* Keep the timer until there is space in the expired ring buffer */
+    node.next = _none;
+    if (_pending_tail == _none) {
+        _pending_head = index;
+    } else {
+        _nodes[_pending_tail].next = index;
+    }
+    _pending_tail = index;
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::FlushPending() {
+    while (_pending_head != _none) {
+        const size_t index = _pending_head;
+        const Node &node = _nodes[index];
+
+        const Expiration expiration = {node.handle, node.data};
+        if (!_expired.Write(&expiration, 1U)) {
+            return;
+        }
+
+        _pending_head = node.next;
+        if (_pending_head == _none) {
+            _pending_tail = _none;
+        }
+        _expiring++;
+        Free(index);
+    }
+}
+
+template <typename T, size_t max_timers, size_t intake_size,
+          size_t expired_size>
+void TimerWheel<T, max_timers, intake_size, expired_size>::Free(
+    const size_t index) {
+    /* A new generation keeps stale handles from cancelling the next timer */
+    const uint64_t handle = _nodes[index].handle + (uint64_t(1U) << 32U);
+
+    /* Only fails while a pop of the free queue is still in progress */
+    while (!_free.Push(handle)) {
+    }
+}
+
+} /* namespace mpsc */
+} /* namespace lockfree */
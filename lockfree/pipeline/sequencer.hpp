@@ -0,0 +1,199 @@
+/**************************************************************
+ * @file sequencer.hpp
+ * @brief A Disruptor style sequencer over a preallocated ring,
+ * written in standard c++11. Lets pipeline stages work on the
+ * same slots in place, each stage waiting on the ones before.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_PIPELINE_SEQUENCER_HPP
+#define LOCKFREE_PIPELINE_SEQUENCER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+#include "../lockfree.hpp"
+#include "wait.hpp"
+
+namespace lockfree {
+namespace pipeline {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t size, size_t max_stages,
+          bool multi_producer = false, typename WaitPolicy = YieldWait>
+class Sequencer {
+    static_assert(size > 2, "Buffer size must be bigger than 2");
+    static_assert((size & (size - 1)) == 0, "Buffer size must be a power of 2");
+    static_assert(max_stages > 0, "There must be at least one stage");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    Sequencer();
+
+    /**
+     * @brief Adds a stage processing the slots right after they are
+     * published. Stages should be added before the sequencer is used.
+     * @param[out] stage Stage index
+     * @retval Operation success, false if there are no free stages
+     */
+    bool AddStage(size_t &stage);
+
+    /**
+     * @brief Adds a stage processing the slots after all of the given stages
+     * have released them. Stages should be added before the sequencer is used.
+     * @param[out] stage Stage index
+     * @param[in] after Pointer to the indexes of the stages to wait for
+     * @param[in] cnt Number of stages to wait for
+     * @retval Operation success, false if there are no free stages or one of
+     * the stages to wait for does not exist
+     */
+    bool AddStage(size_t &stage, const size_t *after, size_t cnt);
+
+    /**
+     * @brief Claims consecutive slots for writing, if all stages are done with
+     * them.
+     * Should only be called from producer threads.
+     * @param[in] cnt Number of slots to claim
+     * @param[out] sequence Sequence of the first claimed slot
+     * @retval Operation success
+     */
+    bool TryClaim(size_t cnt, size_t &sequence);
+
+    /**
+     * @brief Claims consecutive slots for writing, waiting for the stages to
+     * be done with them.
+     * Should only be called from producer threads.
+     * @param[in] cnt Number of slots to claim, at most the buffer size
+     * @retval Sequence of the first claimed slot
+     */
+    size_t Claim(size_t cnt);
+
+    /**
+     * @brief Publishes claimed slots to the stages. With multiple producers,
+     * the slots become visible once all slots before them are published too.
+     * Should only be called from the producer thread that claimed the slots.
+     * @param[in] sequence Sequence of the first slot to publish
+     * @param[in] cnt Number of slots to publish
+     */
+    void Publish(size_t sequence, size_t cnt);
+
+    /**
+     * @brief Acquires the slots available to a stage, without waiting.
+     * Should only be called from the thread of the stage.
+     * @param[in] stage Stage index
+     * @param[out] sequence Sequence of the first available slot
+     * @param[in] max_cnt Maximum number of slots to acquire
+     * @retval Number of slots acquired, 0 if none are available
+     */
+    size_t TryAcquire(size_t stage, size_t &sequence, size_t max_cnt);
+
+    /**
+     * @brief Acquires the slots available to a stage, waiting for at least
+     * one slot.
+     * Should only be called from the thread of the stage.
+     * @param[in] stage Stage index
+     * @param[out] sequence Sequence of the first available slot
+     * @param[in] max_cnt Maximum number of slots to acquire
+     * @retval Number of slots acquired
+     */
+    size_t Acquire(size_t stage, size_t &sequence, size_t max_cnt);
+
+    /**
+     * @brief Releases the oldest acquired slots of a stage to the stages
+     * after it, or to the producers if there are none.
+     * Should only be called from the thread of the stage.
+     * @param[in] stage Stage index
+     * @param[in] cnt Number of slots to release
+     */
+    void Release(size_t stage, size_t cnt);
+
+    /**
+     * @brief Accesses the slot of a sequence, which has to be claimed or
+     * acquired by the calling thread.
+     * @param[in] sequence Sequence of the slot
+     * @retval Reference to the slot
+     */
+    T &Get(size_t sequence);
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    size_t CalcGate(size_t next) const;
+    size_t CalcPublished(size_t next, size_t max_cnt) const;
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Stage {
+#else
+    struct Stage {
+#endif
+        std::atomic_size_t cursor; /**< Sequence of the next slot to process */
+        size_t after_cnt; /**< Number of stages waited for, 0 for producers */
+        size_t after[max_stages]; /**< Stages waited for */
+        bool last;                /**< No stage waits for this one */
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    T _data[size]; /**< Data array */
+    Stage _stages[max_stages];
+    size_t _stage_cnt;
+    /**
+     * Sequence each slot was last published for, used only with multiple
+     * producers. The single producer publishes through _cursor instead.
+     */
+    std::atomic_size_t _published[multi_producer ? size : 1U];
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _claimed; /**< Sequence of the next claim */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _gate; /**< Cached slowest last stage cursor */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _cursor; /**< Published sequence, one producer */
+#else
+    std::atomic_size_t _claimed; /**< Sequence of the next claim */
+    std::atomic_size_t _gate;    /**< Cached slowest last stage cursor */
+    std::atomic_size_t _cursor;  /**< Published sequence, one producer */
+#endif
+};
+
+} /* namespace pipeline */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "sequencer_impl.hpp"
+
+#endif /* LOCKFREE_PIPELINE_SEQUENCER_HPP */
@@ -0,0 +1,277 @@
+/**************************************************************
+ * @file sequencer_impl.hpp
+ * @brief A Disruptor style sequencer over a preallocated ring,
+ * written in standard c++11. Lets pipeline stages work on the
+ * same slots in place, each stage waiting on the ones before.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+#include <cassert>
+
+namespace lockfree {
+namespace pipeline {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Sequencer()
+    : _stage_cnt(0U), _claimed(0U), _gate(0U), _cursor(0U) {
+    for (size_t i = 0; i < max_stages; i++) {
+        _stages[i].cursor.store(0U, std::memory_order_relaxed);
+        _stages[i].after_cnt = 0U;
+        _stages[i].last = false;
+    }
+    /* No sequence of the first revolution matches, so nothing is published */
+    for (size_t i = 0; i < (multi_producer ? size : 1U); i++) {
+        _published[i].store(i - size, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+bool Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::AddStage(
+    size_t &stage) {
+    return AddStage(stage, nullptr, 0U);
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+bool Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::AddStage(
+    size_t &stage, const size_t *after, const size_t cnt) {
+    if (_stage_cnt == max_stages || cnt > max_stages) {
+        return false;
+    }
+    /* Only waiting for existing stages keeps the stages free of cycles */
+    for (size_t i = 0; i < cnt; i++) {
+        if (after[i] >= _stage_cnt) {
+            return false;
+        }
+    }
+
+    Stage &added = _stages[_stage_cnt];
+    for (size_t i = 0; i < cnt; i++) {
+        added.after[i] = after[i];
+        _stages[after[i]].last = false;
+    }
+    added.after_cnt = cnt;
+    added.last = true;
+    added.cursor.store(_claimed.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+
+    stage = _stage_cnt;
+    _stage_cnt++;
+
+    return true;
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+bool Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::TryClaim(
+    const size_t cnt, size_t &sequence) {
+    if (cnt > size) {
+        return false;
+    }
+
+    while (true) {
+        /*
+           Loading the gate first keeps it from being ahead of the claimed
+           sequence, as it was computed from stages processing slots claimed
+           before.
+         */
+        size_t gate = _gate.load(std::memory_order_acquire);
+        const size_t claimed = _claimed.load(std::memory_order_relaxed);
+
+        /* Only look at the stages once the cached gate is reached */
+        if (claimed + cnt - gate > size) {
+            gate = CalcGate(claimed);
+            _gate.store(gate, std::memory_order_release);
+            if (claimed + cnt - gate > size) {
+                return false;
+            }
+        }
+
+        if (!multi_producer) {
+            _claimed.store(claimed + cnt, std::memory_order_relaxed);
+            sequence = claimed;
+            return true;
+        }
+
+        size_t expected = claimed;
+        if (_claimed.compare_exchange_weak(expected, claimed + cnt,
+                                           std::memory_order_relaxed)) {
+            sequence = claimed;
+            return true;
+        }
+    }
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+size_t Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Claim(
+    const size_t cnt) {
+    assert(cnt <= size);
+
+    size_t sequence = 0U;
+    for (size_t attempt = 0; !TryClaim(cnt, sequence); attempt++) {
+        WaitPolicy::Wait(attempt);
+    }
+
+    return sequence;
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+void Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Publish(
+    const size_t sequence, const size_t cnt) {
+    if (!multi_producer) {
+        _cursor.store(sequence + cnt, std::memory_order_release);
+        return;
+    }
+
+    /* Producers publish out of order, so every slot is marked separately */
+    for (size_t i = 0; i < cnt; i++) {
+        _published[(sequence + i) & (size - 1U)].store(
+            sequence + i, std::memory_order_release);
+    }
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+size_t Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::TryAcquire(
+    const size_t stage, size_t &sequence, const size_t max_cnt) {
+    assert(stage < _stage_cnt);
+
+    const Stage &current = _stages[stage];
+    const size_t next = current.cursor.load(std::memory_order_relaxed);
+
+    size_t available = max_cnt;
+    if (current.after_cnt == 0U) {
+        available = CalcPublished(next, max_cnt);
+    } else {
+        /* The slowest of the stages waited for limits the slots */
+        for (size_t i = 0; i < current.after_cnt; i++) {
+            const size_t cursor = _stages[current.after[i]].cursor.load(
+                std::memory_order_acquire);
+            if (cursor - next < available) {
+                available = cursor - next;
+            }
+        }
+    }
+
+    sequence = next;
+    return available;
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+size_t Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Acquire(
+    const size_t stage, size_t &sequence, const size_t max_cnt) {
+    assert(max_cnt > 0U);
+
+    size_t acquired = 0U;
+    for (size_t attempt = 0;
+         (acquired = TryAcquire(stage, sequence, max_cnt)) == 0U; attempt++) {
+        WaitPolicy::Wait(attempt);
+    }
+
+    return acquired;
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+void Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Release(
+    const size_t stage, const size_t cnt) {
+    assert(stage < _stage_cnt);
+
+    std::atomic_size_t &cursor = _stages[stage].cursor;
+    cursor.store(cursor.load(std::memory_order_relaxed) + cnt,
+                 std::memory_order_release);
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+T &Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::Get(
+    const size_t sequence) {
+    return _data[sequence & (size - 1U)];
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+size_t Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::CalcGate(
+    const size_t next) const {
+    /* The slowest of the last stages limits the producers */
+    size_t max_lag = 0U;
+    for (size_t i = 0; i < _stage_cnt; i++) {
+        if (!_stages[i].last) {
+            continue;
+        }
+        size_t lag = next - _stages[i].cursor.load(std::memory_order_acquire);
+        /* A stage is never more than the buffer behind, so it is ahead of
+         * a stale claimed sequence of another producer */
+        if (lag > size) {
+            lag = 0U;
+        }
+        if (lag > max_lag) {
+            max_lag = lag;
+        }
+    }
+
+    return next - max_lag;
+}
+
+template <typename T, size_t size, size_t max_stages, bool multi_producer,
+          typename WaitPolicy>
+size_t
+Sequencer<T, size, max_stages, multi_producer, WaitPolicy>::CalcPublished(
+    const size_t next, const size_t max_cnt) const {
+    if (!multi_producer) {
+        const size_t published =
+            _cursor.load(std::memory_order_acquire) - next;
+        return published < max_cnt ? published : max_cnt;
+    }
+
+    /* Only the slots published without gaps are available */
+    size_t published = 0U;
+    while (published < max_cnt &&
+           _published[(next + published) & (size - 1U)].load(
+               std::memory_order_acquire) == next + published) {
+        published++;
+    }
+
+    return published;
+}
+
+} /* namespace pipeline */
+} /* namespace lockfree */
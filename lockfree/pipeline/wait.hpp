@@ -0,0 +1,114 @@
+/**************************************************************
+ * @file wait.hpp
+ * @brief Wait strategies for the Sequencer, trading latency
+ * for CPU usage while stages wait on each other.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_PIPELINE_WAIT_HPP
+#define LOCKFREE_PIPELINE_WAIT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace lockfree {
+namespace pipeline {
+/*************************** TYPES ****************************/
+
+/**
+ * Spins without ever giving up the CPU, for the lowest latency when every
+ * stage has a core of its own.
+ */
+class BusySpinWait {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    /**
+     * @brief Waits before the next attempt.
+     * @param[in] attempt Number of failed attempts so far
+     */
+    static void Wait(size_t attempt) { (void)attempt; }
+};
+
+/**
+ * Spins for a while, then yields the CPU to other threads between attempts.
+ */
+class YieldWait {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    /**
+     * @brief Waits before the next attempt.
+     * @param[in] attempt Number of failed attempts so far
+     */
+    static void Wait(size_t attempt) {
+        if (attempt >= _spins) {
+            std::this_thread::yield();
+        }
+    }
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _spins = 100U;
+};
+
+/**
+ * Spins, then yields and finally sleeps between attempts, for stages that
+ * are mostly idle and should not occupy a core.
+ */
+class SleepWait {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    /**
+     * @brief Waits before the next attempt.
+     * @param[in] attempt Number of failed attempts so far
+     */
+    static void Wait(size_t attempt) {
+        if (attempt >= _spins + _yields) {
+            std::this_thread::sleep_for(std::chrono::microseconds(_sleep_us));
+        } else if (attempt >= _spins) {
+            std::this_thread::yield();
+        }
+    }
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _spins = 100U;
+    static constexpr size_t _yields = 100U;
+    static constexpr unsigned _sleep_us = 100U;
+};
+
+} /* namespace pipeline */
+} /* namespace lockfree */
+
+#endif /* LOCKFREE_PIPELINE_WAIT_HPP */
@@ -0,0 +1,204 @@
+/**************************************************************
+ * @file epoch.hpp
+ * @brief Epoch based memory reclamation written in standard
+ * c++11 for lock-free data structures holding dynamically
+ * allocated nodes. Objects are deleted once no thread can
+ * still be reading them.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_RECLAIM_EPOCH_HPP
+#define LOCKFREE_RECLAIM_EPOCH_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace reclaim {
+/*************************** TYPES ****************************/
+
+template <size_t max_threads, size_t retire_size = 128U> class Epoch {
+    static_assert(max_threads > 0, "There must be at least one thread");
+    static_assert(retire_size > 0, "Retire list size must be greater than 0");
+
+    /********************** PUBLIC TYPES **************************/
+  public:
+    /**
+     * @brief Marks a critical section of a registered thread, objects
+     * retired after it started are not deleted until it ends. Guards of
+     * the same thread can be nested.
+     */
+    class Guard {
+      public:
+        Guard(Epoch &epoch, size_t thread);
+        ~Guard();
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+      private:
+        Epoch &_epoch;
+        size_t _thread;
+    };
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    Epoch();
+
+    /**
+     * @brief Deletes all retired objects that are still pending. No thread
+     * may be in a critical section anymore.
+     */
+    ~Epoch();
+
+    Epoch(const Epoch &) = delete;
+    Epoch &operator=(const Epoch &) = delete;
+
+    /**
+     * @brief Claims a thread slot, which owns its own list of retired
+     * objects.
+     * Can be called from any thread.
+     * @param[out] thread Thread index to pass to the other methods
+     * @retval Operation success, false if all slots are taken
+     */
+    bool Register(size_t &thread);
+
+    /**
+     * @brief Releases a thread slot. Objects the thread retired that cannot
+     * be deleted yet stay with the slot, for the next thread claiming it or
+     * the destructor to delete.
+     * Should only be called from the thread owning the slot, outside of a
+     * critical section.
+     * @param[in] thread Thread index
+     */
+    void Unregister(size_t thread);
+
+    /**
+     * @brief Schedules an object for deletion once no thread can still be
+     * reading it, the object has to be unreachable for new critical sections
+     * already. Tries to delete earlier objects every retire_size / 4
+     * retires, or when the retire list of the thread is full.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] ptr Object to delete
+     * @param[in] deleter Function deleting the object
+     * @retval Operation success, false if the retire list is full because a
+     * thread has been in a critical section for too long
+     */
+    bool Retire(size_t thread, void *ptr, void (*deleter)(void *));
+
+    /**
+     * @brief Schedules an object allocated with new for deletion once no
+     * thread can still be reading it.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] ptr Object to delete
+     * @retval Operation success, false if the retire list is full
+     */
+    template <typename T> bool Retire(size_t thread, T *ptr);
+
+    /**
+     * @brief Advances the epoch if possible and deletes the objects retired
+     * by the thread that no thread can still be reading.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @retval Number of objects deleted
+     */
+    size_t Reclaim(size_t thread);
+
+    /**
+     * @brief Gets the number of objects retired by the thread that have not
+     * been deleted yet.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @retval Number of pending objects
+     */
+    size_t GetPending(size_t thread) const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    void Enter(size_t thread);
+    void Exit(size_t thread);
+    bool TryAdvance();
+
+    template <typename T> static void Delete(void *ptr);
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Retired {
+        void *ptr;
+        void (*deleter)(void *);
+        uint64_t epoch; /**< Global epoch when the object was retired */
+    };
+
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Slot {
+#else
+    struct Slot {
+#endif
+        std::atomic<uint64_t> local; /**< Epoch << 1 | active */
+        std::atomic_bool used;
+        size_t nesting; /**< Guard depth, only used by the owner */
+        size_t since_reclaim; /**< Retires since the last reclaim */
+        size_t head;          /**< Oldest retired object */
+        size_t count;         /**< Retired objects pending */
+        Retired retired[retire_size];
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr uint64_t _active = 1U;
+    static constexpr size_t _batch = retire_size / 4U > 0U ? retire_size / 4U
+                                                           : 1U;
+
+    Slot _slots[max_threads];
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH) std::atomic<uint64_t> _global;
+#else
+    std::atomic<uint64_t> _global;
+#endif
+};
+
+} /* namespace reclaim */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "epoch_impl.hpp"
+
+#endif /* LOCKFREE_RECLAIM_EPOCH_HPP */
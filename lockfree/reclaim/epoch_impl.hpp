@@ -0,0 +1,245 @@
+/**************************************************************
+ * @file epoch_impl.hpp
+ * @brief Epoch based memory reclamation written in standard
+ * c++11 for lock-free data structures holding dynamically
+ * allocated nodes. Objects are deleted once no thread can
+ * still be reading them.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <cassert>
+
+namespace lockfree {
+namespace reclaim {
+/********************** PUBLIC METHODS ************************/
+
+template <size_t max_threads, size_t retire_size>
+Epoch<max_threads, retire_size>::Guard::Guard(Epoch &epoch, size_t thread)
+    : _epoch(epoch), _thread(thread) {
+    _epoch.Enter(_thread);
+}
+
+template <size_t max_threads, size_t retire_size>
+Epoch<max_threads, retire_size>::Guard::~Guard() {
+    _epoch.Exit(_thread);
+}
+
+template <size_t max_threads, size_t retire_size>
+Epoch<max_threads, retire_size>::Epoch() : _global(0U) {
+    for (size_t i = 0; i < max_threads; i++) {
+        _slots[i].local.store(0U, std::memory_order_relaxed);
+        _slots[i].used.store(false, std::memory_order_relaxed);
+        _slots[i].nesting = 0U;
+        _slots[i].since_reclaim = 0U;
+        _slots[i].head = 0U;
+        _slots[i].count = 0U;
+    }
+}
+
+template <size_t max_threads, size_t retire_size>
+Epoch<max_threads, retire_size>::~Epoch() {
+    for (size_t i = 0; i < max_threads; i++) {
+        Slot &slot = _slots[i];
+        for (; slot.count > 0U; slot.count--) {
+            const Retired &retired = slot.retired[slot.head];
+            retired.deleter(retired.ptr);
+            slot.head = (slot.head + 1U) % retire_size;
+        }
+    }
+}
+
+template <size_t max_threads, size_t retire_size>
+bool Epoch<max_threads, retire_size>::Register(size_t &thread) {
+    for (size_t i = 0; i < max_threads; i++) {
+        bool used = false;
+        /* Acquire pairs with Unregister() to take over the retire list */
+        if (_slots[i].used.compare_exchange_strong(used, true,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+            thread = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <size_t max_threads, size_t retire_size>
+void Epoch<max_threads, retire_size>::Unregister(size_t thread) {
+    assert(thread < max_threads);
+    assert(_slots[thread].nesting == 0U);
+
+    Reclaim(thread);
+    _slots[thread].used.store(false, std::memory_order_release);
+}
+
+template <size_t max_threads, size_t retire_size>
+bool Epoch<max_threads, retire_size>::Retire(size_t thread, void *ptr,
+                                             void (*deleter)(void *)) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+
+    if (++slot.since_reclaim >= _batch || slot.count == retire_size) {
+        Reclaim(thread);
+    }
+    if (slot.count == retire_size) {
+        return false;
+    }
+
+    /* The object is unlinked already, so any thread still reading it entered
+     * its critical section no later than the current epoch */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t epoch = _global.load(std::memory_order_relaxed);
+
+    slot.retired[(slot.head + slot.count) % retire_size] = {ptr, deleter,
+                                                            epoch};
+    slot.count++;
+
+    return true;
+}
+
+template <size_t max_threads, size_t retire_size>
+template <typename T>
+bool Epoch<max_threads, retire_size>::Retire(size_t thread, T *ptr) {
+    return Retire(thread, ptr, &Delete<T>);
+}
+
+template <size_t max_threads, size_t retire_size>
+size_t Epoch<max_threads, retire_size>::Reclaim(size_t thread) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+    slot.since_reclaim = 0U;
+
+    if (slot.count == 0U) {
+        return 0U;
+    }
+
+    TryAdvance();
+    const uint64_t global = _global.load(std::memory_order_acquire);
+
+    /*
+     * Once the global epoch is two past the one an object was retired in,
+     * every thread has left the critical sections that could see it. The
+     * list is ordered by epoch, so stop at the first one that is too recent.
+     */
+    size_t reclaimed = 0U;
+    while (slot.count > 0U && slot.retired[slot.head].epoch + 2U <= global) {
+        const Retired &retired = slot.retired[slot.head];
+        retired.deleter(retired.ptr);
+        slot.head = (slot.head + 1U) % retire_size;
+        slot.count--;
+        reclaimed++;
+    }
+
+    return reclaimed;
+}
+
+template <size_t max_threads, size_t retire_size>
+size_t Epoch<max_threads, retire_size>::GetPending(size_t thread) const {
+    assert(thread < max_threads);
+
+    return _slots[thread].count;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <size_t max_threads, size_t retire_size>
+void Epoch<max_threads, retire_size>::Enter(size_t thread) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+
+    if (slot.nesting++ > 0U) {
+        return;
+    }
+
+    /*
+     * Announce the epoch, then make sure it is still current once the
+     * announcement is visible. Otherwise the epoch could have moved on twice
+     * in between, freeing objects this thread is about to read.
+     */
+    uint64_t epoch = _global.load(std::memory_order_relaxed);
+    while (true) {
+        slot.local.store((epoch << 1U) | _active, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const uint64_t current = _global.load(std::memory_order_relaxed);
+        if (current == epoch) {
+            break;
+        }
+        epoch = current;
+    }
+}
+
+template <size_t max_threads, size_t retire_size>
+void Epoch<max_threads, retire_size>::Exit(size_t thread) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+    assert(slot.nesting > 0U);
+
+    if (--slot.nesting > 0U) {
+        return;
+    }
+
+    /* Release orders the reads of the critical section before leaving it */
+    slot.local.store(0U, std::memory_order_release);
+}
+
+template <size_t max_threads, size_t retire_size>
+bool Epoch<max_threads, retire_size>::TryAdvance() {
+    uint64_t epoch = _global.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    /* The epoch can only move on once every thread in a critical section has
+     * seen the current one */
+    for (size_t i = 0; i < max_threads; i++) {
+        const uint64_t local = _slots[i].local.load(std::memory_order_acquire);
+        if ((local & _active) != 0U && (local >> 1U) != epoch) {
+            return false;
+        }
+    }
+
+    return _global.compare_exchange_strong(epoch, epoch + 1U,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed);
+}
+
+template <size_t max_threads, size_t retire_size>
+template <typename T>
+void Epoch<max_threads, retire_size>::Delete(void *ptr) {
+    delete static_cast<T *>(ptr);
+}
+
+} /* namespace reclaim */
+} /* namespace lockfree */
@@ -0,0 +1,200 @@
+/**************************************************************
+ * @file hazard_pointers.hpp
+ * @brief Hazard pointer based memory reclamation written in
+ * standard c++11 for lock-free data structures holding
+ * dynamically allocated nodes, with a bound on the number of
+ * objects waiting for deletion.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_RECLAIM_HAZARD_POINTERS_HPP
+#define LOCKFREE_RECLAIM_HAZARD_POINTERS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace reclaim {
+/*************************** TYPES ****************************/
+
+template <size_t max_threads, size_t hazards = 2U,
+          size_t retire_size = 2U * max_threads * hazards>
+class HazardPointers {
+    static_assert(max_threads > 0, "There must be at least one thread");
+    static_assert(hazards > 0, "There must be at least one hazard pointer");
+    static_assert(retire_size > max_threads * hazards,
+                  "Retire list size must exceed the total hazard pointers");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    HazardPointers();
+
+    /**
+     * @brief Deletes all retired objects that are still pending. No thread
+     * may hold a hazard pointer anymore.
+     */
+    ~HazardPointers();
+
+    HazardPointers(const HazardPointers &) = delete;
+    HazardPointers &operator=(const HazardPointers &) = delete;
+
+    /**
+     * @brief Claims a thread slot, which owns hazards hazard pointers and a
+     * list of retired objects.
+     * Can be called from any thread.
+     * @param[out] thread Thread index to pass to the other methods
+     * @retval Operation success, false if all slots are taken
+     */
+    bool Register(size_t &thread);
+
+    /**
+     * @brief Clears the hazard pointers of a thread slot and releases it.
+     * Objects the thread retired that cannot be deleted yet stay with the
+     * slot, for the next thread claiming it or the destructor to delete.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     */
+    void Unregister(size_t thread);
+
+    /**
+     * @brief Loads a pointer and protects the object it points to from
+     * being deleted, until the hazard pointer is cleared or reused.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] index Hazard pointer index, less than hazards
+     * @param[in] source Pointer to load, it has to be changed before the
+     * object it points to is retired
+     * @retval Protected pointer, which can be nullptr
+     */
+    template <typename T>
+    T *Protect(size_t thread, size_t index, const std::atomic<T *> &source);
+
+    /**
+     * @brief Protects an object known to be reachable, for instance one that
+     * is protected by another hazard pointer of the thread already.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] index Hazard pointer index, less than hazards
+     * @param[in] ptr Object to protect
+     */
+    void Set(size_t thread, size_t index, const void *ptr);
+
+    /**
+     * @brief Clears a hazard pointer, the object it protected can be deleted
+     * once retired.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] index Hazard pointer index, less than hazards
+     */
+    void Clear(size_t thread, size_t index);
+
+    /**
+     * @brief Schedules an object for deletion once no hazard pointer protects
+     * it, the object has to be unreachable for new readers already. Scans the
+     * hazard pointers of all threads once the retire list of the thread is
+     * full, which always frees space since the list is bigger than the total
+     * number of hazard pointers.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] ptr Object to delete
+     * @param[in] deleter Function deleting the object
+     */
+    void Retire(size_t thread, void *ptr, void (*deleter)(void *));
+
+    /**
+     * @brief Schedules an object allocated with new for deletion once no
+     * hazard pointer protects it.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @param[in] ptr Object to delete
+     */
+    template <typename T> void Retire(size_t thread, T *ptr);
+
+    /**
+     * @brief Scans the hazard pointers of all threads and deletes the objects
+     * retired by the thread that are not protected.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @retval Number of objects deleted
+     */
+    size_t Reclaim(size_t thread);
+
+    /**
+     * @brief Gets the number of objects retired by the thread that have not
+     * been deleted yet.
+     * Should only be called from the thread owning the slot.
+     * @param[in] thread Thread index
+     * @retval Number of pending objects
+     */
+    size_t GetPending(size_t thread) const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    template <typename T> static void Delete(void *ptr);
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Retired {
+        void *ptr;
+        void (*deleter)(void *);
+    };
+
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Slot {
+#else
+    struct Slot {
+#endif
+        std::atomic<const void *> hazard[hazards];
+        std::atomic_bool used;
+        size_t count; /**< Retired objects pending, only used by the owner */
+        Retired retired[retire_size];
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    Slot _slots[max_threads];
+};
+
+} /* namespace reclaim */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "hazard_pointers_impl.hpp"
+
+#endif /* LOCKFREE_RECLAIM_HAZARD_POINTERS_HPP */
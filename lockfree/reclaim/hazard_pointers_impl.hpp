@@ -0,0 +1,233 @@
+/**************************************************************
+ * @file hazard_pointers_impl.hpp
+ * @brief Hazard pointer based memory reclamation written in
+ * standard c++11 for lock-free data structures holding
+ * dynamically allocated nodes, with a bound on the number of
+ * objects waiting for deletion.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace lockfree {
+namespace reclaim {
+/********************** PUBLIC METHODS ************************/
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+HazardPointers<max_threads, hazards, retire_size>::HazardPointers() {
+    for (size_t i = 0; i < max_threads; i++) {
+        for (size_t h = 0; h < hazards; h++) {
+            _slots[i].hazard[h].store(nullptr, std::memory_order_relaxed);
+        }
+        _slots[i].used.store(false, std::memory_order_relaxed);
+        _slots[i].count = 0U;
+    }
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+HazardPointers<max_threads, hazards, retire_size>::~HazardPointers() {
+    for (size_t i = 0; i < max_threads; i++) {
+        for (size_t r = 0; r < _slots[i].count; r++) {
+            _slots[i].retired[r].deleter(_slots[i].retired[r].ptr);
+        }
+        _slots[i].count = 0U;
+    }
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+bool HazardPointers<max_threads, hazards, retire_size>::Register(
+    size_t &thread) {
+    for (size_t i = 0; i < max_threads; i++) {
+        bool used = false;
+        /* Acquire pairs with Unregister() to take over the retire list */
+        if (_slots[i].used.compare_exchange_strong(used, true,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+            thread = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+void HazardPointers<max_threads, hazards, retire_size>::Unregister(
+    size_t thread) {
+    assert(thread < max_threads);
+
+    for (size_t h = 0; h < hazards; h++) {
+        Clear(thread, h);
+    }
+    Reclaim(thread);
+    _slots[thread].used.store(false, std::memory_order_release);
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+template <typename T>
+T *HazardPointers<max_threads, hazards, retire_size>::Protect(
+    size_t thread, size_t index, const std::atomic<T *> &source) {
+    assert(thread < max_threads);
+    assert(index < hazards);
+    std::atomic<const void *> &hazard = _slots[thread].hazard[index];
+
+    /*
+     * Publish the pointer, then make sure the source still holds it once the
+     * hazard pointer is visible. A retiring thread scans after unlinking, so
+     * it either sees the hazard pointer or this thread sees the change.
+     */
+    T *ptr = source.load(std::memory_order_relaxed);
+    while (true) {
+        hazard.store(ptr, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        T *const current = source.load(std::memory_order_acquire);
+        if (current == ptr) {
+            return ptr;
+        }
+        ptr = current;
+    }
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+void HazardPointers<max_threads, hazards, retire_size>::Set(size_t thread,
+                                                            size_t index,
+                                                            const void *ptr) {
+    assert(thread < max_threads);
+    assert(index < hazards);
+
+    _slots[thread].hazard[index].store(ptr, std::memory_order_seq_cst);
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+void HazardPointers<max_threads, hazards, retire_size>::Clear(size_t thread,
+                                                              size_t index) {
+    assert(thread < max_threads);
+    assert(index < hazards);
+
+    /* Release orders the reads of the object before it can be deleted */
+    _slots[thread].hazard[index].store(nullptr, std::memory_order_release);
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+void HazardPointers<max_threads, hazards, retire_size>::Retire(
+    size_t thread, void *ptr, void (*deleter)(void *)) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+
+    slot.retired[slot.count] = {ptr, deleter};
+    slot.count++;
+
+    /* Scanning only when full amortizes it over retire_size - total hazard
+     * pointers retires at least */
+    if (slot.count == retire_size) {
+        Reclaim(thread);
+    }
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+template <typename T>
+void HazardPointers<max_threads, hazards, retire_size>::Retire(size_t thread,
+                                                               T *ptr) {
+    Retire(thread, ptr, &Delete<T>);
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+size_t HazardPointers<max_threads, hazards, retire_size>::Reclaim(
+    size_t thread) {
+    assert(thread < max_threads);
+    Slot &slot = _slots[thread];
+
+    if (slot.count == 0U) {
+        return 0U;
+    }
+
+    /* Pairs with the fence in Protect(), the objects are unlinked already */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const void *protected_ptrs[max_threads * hazards];
+    size_t protected_cnt = 0U;
+    for (size_t i = 0; i < max_threads; i++) {
+        for (size_t h = 0; h < hazards; h++) {
+            const void *ptr =
+                _slots[i].hazard[h].load(std::memory_order_acquire);
+            if (ptr != nullptr) {
+                protected_ptrs[protected_cnt++] = ptr;
+            }
+        }
+    }
+    /* std::less gives a total order even for unrelated pointers */
+    const std::less<const void *> less;
+    std::sort(protected_ptrs, protected_ptrs + protected_cnt, less);
+
+    /* Delete the unprotected objects, compacting the protected ones */
+    size_t kept = 0U;
+    for (size_t r = 0; r < slot.count; r++) {
+        const Retired retired = slot.retired[r];
+        if (std::binary_search(protected_ptrs, protected_ptrs + protected_cnt,
+                               static_cast<const void *>(retired.ptr),
+                               less)) {
+            slot.retired[kept++] = retired;
+        } else {
+            retired.deleter(retired.ptr);
+        }
+    }
+
+    const size_t reclaimed = slot.count - kept;
+    slot.count = kept;
+
+    return reclaimed;
+}
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+size_t HazardPointers<max_threads, hazards, retire_size>::GetPending(
+    size_t thread) const {
+    assert(thread < max_threads);
+
+    return _slots[thread].count;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <size_t max_threads, size_t hazards, size_t retire_size>
+template <typename T>
+void HazardPointers<max_threads, hazards, retire_size>::Delete(void *ptr) {
+    delete static_cast<T *>(ptr);
+}
+
+} /* namespace reclaim */
+} /* namespace lockfree */
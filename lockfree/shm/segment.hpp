@@ -0,0 +1,164 @@
+/**************************************************************
+ * @file segment.hpp
+ * @brief A POSIX shared memory segment helper for placing
+ * the lock-free data structures in memory shared between
+ * processes.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_SHM_SEGMENT_HPP
+#define LOCKFREE_SHM_SEGMENT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <sys/types.h>
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace shm {
+/*************************** TYPES ****************************/
+
+template <typename Container> class Segment {
+    static_assert(std::is_standard_layout<Container>::value,
+                  "The container must have a standard layout");
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+    static_assert(std::atomic_size_t::is_always_lock_free,
+                  "Size atomics must be lock-free to be shared between "
+                  "processes");
+#else
+    static_assert((sizeof(size_t) == sizeof(long) ? ATOMIC_LONG_LOCK_FREE
+                                                  : ATOMIC_LLONG_LOCK_FREE) ==
+                      2,
+                  "Size atomics must be lock-free to be shared between "
+                  "processes");
+#endif
+    static_assert(ATOMIC_INT_LOCK_FREE == 2,
+                  "Int atomics must be lock-free to be shared between "
+                  "processes");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    Segment();
+    ~Segment();
+
+    Segment(const Segment &) = delete;
+    Segment &operator=(const Segment &) = delete;
+
+    /**
+     * @brief Creates a named shared memory segment and constructs the
+     * container in it. Fails if a segment with the same name exists.
+     * @param[in] Segment name, in the "/name" form
+     * @param[in] Permissions of the segment
+     * @retval Operation success
+     */
+    bool Create(const char *name, mode_t mode = 0600);
+
+    /**
+     * @brief Attaches to a named shared memory segment created by another
+     * process. Fails if the segment doesn't exist, isn't initialized yet, or
+     * holds an incompatible container layout.
+     * @param[in] Segment name, in the "/name" form
+     * @retval Operation success
+     */
+    bool Attach(const char *name);
+
+    /**
+     * @brief Unmaps the segment from this process.
+     * The segment itself persists until it is unlinked.
+     * @retval None
+     */
+    void Detach();
+
+    /**
+     * @brief Gets the container placed in the segment.
+     * @retval Pointer to the container, nullptr if not created or attached
+     */
+    Container *Get() const;
+
+    /**
+     * @brief Removes a named shared memory segment, processes that are
+     * attached keep their mappings.
+     * @param[in] Segment name, in the "/name" form
+     * @retval Operation success
+     */
+    static bool Unlink(const char *name);
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    /* Describes everything both processes must agree on for the container to
+     * be shared, written once by the creating process. */
+    struct Header {
+        std::atomic<uint32_t> state; /**< Holds _magic once initialized */
+        uint32_t layout_version;
+        uint32_t cache_coherent;
+        uint32_t cacheline_length;
+        uint64_t container_size;
+        uint64_t container_alignment;
+        uint64_t size_t_size;
+        uint64_t container_id;
+
+        Header() : state(0U) {}
+    };
+
+    struct Layout {
+        Header header;
+        Container container;
+    };
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    static bool IsCompatible(const Header &header);
+    static uint64_t ContainerId();
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr uint32_t _magic = 0x4C4B4652U; /* "LKFR" */
+    static constexpr uint32_t _layout_version = 1U;
+
+    Layout *_layout; /**< Mapped segment, nullptr if not mapped */
+};
+
+} /* namespace shm */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "segment_impl.hpp"
+
+#endif /* LOCKFREE_SHM_SEGMENT_HPP */
@@ -0,0 +1,194 @@
+/**************************************************************
+ * @file segment_impl.hpp
+ * @brief A POSIX shared memory segment helper for placing
+ * the lock-free data structures in memory shared between
+ * processes.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lockfree {
+namespace shm {
+/********************** PUBLIC METHODS ************************/
+
+template <typename Container>
+Segment<Container>::Segment() : _layout(nullptr) {}
+
+template <typename Container> Segment<Container>::~Segment() { Detach(); }
+
+template <typename Container>
+bool Segment<Container>::Create(const char *name, const mode_t mode) {
+    if (_layout != nullptr) {
+        return false;
+    }
+
+    /* Exclusive creation, a stale segment has to be unlinked explicitly */
+    const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, mode);
+    if (fd < 0) {
+        return false;
+    }
+
+    if (ftruncate(fd, sizeof(Layout)) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+
+    void *mem = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(name);
+        return false;
+    }
+
+    Layout *layout = new (mem) Layout();
+    layout->header.layout_version = _layout_version;
+    layout->header.cache_coherent = LOCKFREE_CACHE_COHERENT ? 1U : 0U;
+    layout->header.cacheline_length = LOCKFREE_CACHELINE_LENGTH;
+    layout->header.container_size = sizeof(Container);
+    layout->header.container_alignment = alignof(Container);
+    layout->header.size_t_size = sizeof(size_t);
+    layout->header.container_id = ContainerId();
+
+    /* Publish the constructed container to attaching processes */
+    layout->header.state.store(_magic, std::memory_order_release);
+
+    _layout = layout;
+    return true;
+}
+
+template <typename Container>
+bool Segment<Container>::Attach(const char *name) {
+    if (_layout != nullptr) {
+        return false;
+    }
+
+    const int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return false;
+    }
+
+    /* The size is zero until the creating process resizes the segment */
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) != sizeof(Layout)) {
+        close(fd);
+        return false;
+    }
+
+    void *mem = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        return false;
+    }
+
+    Layout *layout = static_cast<Layout *>(mem);
+    if (!IsCompatible(layout->header)) {
+        munmap(mem, sizeof(Layout));
+        return false;
+    }
+
+    _layout = layout;
+    return true;
+}
+
+template <typename Container> void Segment<Container>::Detach() {
+    if (_layout != nullptr) {
+        munmap(_layout, sizeof(Layout));
+        _layout = nullptr;
+    }
+}
+
+template <typename Container> Container *Segment<Container>::Get() const {
+    if (_layout == nullptr) {
+        return nullptr;
+    }
+
+    return &_layout->container;
+}
+
+template <typename Container>
+bool Segment<Container>::Unlink(const char *name) {
+    return shm_unlink(name) == 0;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename Container>
+bool Segment<Container>::IsCompatible(const Header &header) {
+    /* Acquire pairs with the release in Create(), making the header and the
+     * container contents visible */
+    if (header.state.load(std::memory_order_acquire) != _magic) {
+        return false;
+    }
+
+    return header.layout_version == _layout_version &&
+           header.cache_coherent == (LOCKFREE_CACHE_COHERENT ? 1U : 0U) &&
+           header.cacheline_length == LOCKFREE_CACHELINE_LENGTH &&
+           header.container_size == sizeof(Container) &&
+           header.container_alignment == alignof(Container) &&
+           header.size_t_size == sizeof(size_t) &&
+           header.container_id == ContainerId();
+}
+
+template <typename Container> uint64_t Segment<Container>::ContainerId() {
+    /* Containers of the same size can still differ in layout, so the
+     * signature of this function, which names the container type, is hashed
+     * with FNV-1a to tell them apart */
+#if defined(_MSC_VER)
+    const char *signature = __FUNCSIG__;
+#else
+    const char *signature = __PRETTY_FUNCTION__;
+#endif
+
+    uint64_t hash = 0xCBF29CE484222325U;
+    for (; *signature != '\0'; signature++) {
+        hash ^= static_cast<uint8_t>(*signature);
+        hash *= 0x100000001B3U;
+    }
+
+    return hash;
+}
+
+} /* namespace shm */
+} /* namespace lockfree */
@@ -0,0 +1,211 @@
+/**************************************************************
+ * @file broadcast_buf.hpp
+ * @brief A broadcast ring buffer implementation written in
+ * standard c++11, where every consumer reads every element.
+ * Lock-free for single producer multiple consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_BROADCAST_BUF_HPP
+#define LOCKFREE_BROADCAST_BUF_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
+
+namespace lockfree {
+namespace spmc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t size, size_t max_consumers, bool lossy = false>
+class BroadcastBuf {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(size > 2, "Buffer size must be bigger than 2");
+    static_assert((size & (size - 1)) == 0, "Buffer size must be a power of 2");
+    static_assert(max_consumers > 0, "There must be at least one consumer");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    BroadcastBuf();
+
+    /**
+     * @brief Claims a consumer slot. The consumer reads every element written
+     * after it was registered.
+     * Should only be called from the consumer thread.
+     * @param[out] consumer Consumer index to pass to Read()
+     * @retval Operation success, false if all slots are taken
+     */
+    bool Register(size_t &consumer);
+
+    /**
+     * @brief Releases a consumer slot, the producer stops waiting for it.
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     */
+    void Unregister(size_t consumer);
+
+    /**
+     * @brief Writes data to the broadcast buffer. Unless the buffer is lossy,
+     * the write fails if it would overwrite data the slowest registered
+     * consumer has not read yet.
+     * Should only be called from the producer thread.
+     * @param[in] Pointer to the data to write
+     * @param[in] Number of elements to write
+     * @retval Write success
+     */
+    bool Write(const T *data, size_t cnt);
+
+    /**
+     * @brief Writes data to the broadcast buffer.
+     * Should only be called from the producer thread.
+     * @param[in] Data array to write
+     * @retval Write success
+     */
+    template <size_t arr_size> bool Write(const std::array<T, arr_size> &data);
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    /**
+     * @brief Writes data to the broadcast buffer.
+     * Should only be called from the producer thread.
+     * @param[in] Span of data to write
+     * @retval Write success
+     */
+    bool Write(std::span<const T> data);
+#endif
+
+    /**
+     * @brief Reads data from the broadcast buffer for a consumer. If the
+     * buffer is lossy and the consumer has been overrun by the producer, the
+     * read fails and the consumer skips to the oldest data still in the
+     * buffer, see GetOverrun().
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     * @param[out] Pointer to the space to read the data to
+     * @param[in] Number of elements to read
+     * @retval Read success
+     */
+    bool Read(size_t consumer, T *data, size_t cnt);
+
+    /**
+     * @brief Reads data from the broadcast buffer for a consumer.
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     * @param[out] Array to write the read to
+     * @retval Read success
+     */
+    template <size_t arr_size>
+    bool Read(size_t consumer, std::array<T, arr_size> &data);
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    /**
+     * @brief Reads data from the broadcast buffer for a consumer.
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     * @param[out] Span to read to
+     * @retval Read success
+     */
+    bool Read(size_t consumer, std::span<T> data);
+#endif
+
+    /**
+     * @brief Gets the number of elements available to a consumer.
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     * @retval Number of available elements
+     */
+    size_t GetAvailable(size_t consumer) const;
+
+    /**
+     * @brief Gets the number of elements a consumer has lost to being overrun
+     * since it was registered. Always 0 unless the buffer is lossy.
+     * Should only be called from the consumer thread owning the slot.
+     * @param[in] consumer Consumer index
+     * @retval Number of lost elements
+     */
+    size_t GetOverrun(size_t consumer) const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    size_t CalcLimit(size_t w) const;
+    void OnOverrun(size_t consumer, size_t r);
+    void CopyIn(size_t idx, const T *data, size_t cnt, std::false_type);
+    void CopyIn(size_t idx, const T *data, size_t cnt, std::true_type);
+    void CopyOut(T *data, size_t idx, size_t cnt, std::false_type) const;
+    void CopyOut(T *data, size_t idx, size_t cnt, std::true_type) const;
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Consumer {
+#else
+    struct Consumer {
+#endif
+        std::atomic_size_t r;  /**< Read cursor */
+        std::atomic_bool active;
+        size_t overrun; /**< Elements lost, only used by the consumer */
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _words =
+        (sizeof(T) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+    T _data[lossy ? 1U : size]; /**< Data array, unless lossy */
+    /* Data array if lossy, as consumers can read it while it is overwritten */
+    std::atomic_size_t _lossy_data[lossy ? size * _words : 1U];
+    Consumer _consumers[max_consumers];
+#if LOCKFREE_CACHE_COHERENT
+    alignas(
+        LOCKFREE_CACHELINE_LENGTH) std::atomic_size_t _w; /**< Write cursor */
+#else
+    std::atomic_size_t _w; /**< Write cursor */
+#endif
+    std::atomic_size_t _claim; /**< End of the data being written, if lossy */
+    size_t _limit; /**< Cursor the producer can write up to, cached */
+};
+
+} /* namespace spmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "broadcast_buf_impl.hpp"
+
+#endif /* LOCKFREE_BROADCAST_BUF_HPP */
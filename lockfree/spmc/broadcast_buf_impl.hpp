@@ -0,0 +1,321 @@
+/**************************************************************
+ * @file broadcast_buf_impl.hpp
+ * @brief A broadcast ring buffer implementation written in
+ * standard c++11, where every consumer reads every element.
+ * Lock-free for single producer multiple consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+#include <cassert>
+#include <cstring>
+
+namespace lockfree {
+namespace spmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+BroadcastBuf<T, size, max_consumers, lossy>::BroadcastBuf()
+    : _w(0U), _claim(0U), _limit(size) {
+    for (size_t i = 0; i < max_consumers; i++) {
+        _consumers[i].r.store(0U, std::memory_order_relaxed);
+        _consumers[i].active.store(false, std::memory_order_relaxed);
+        _consumers[i].overrun = 0U;
+    }
+    for (size_t i = 0; i < (lossy ? size * _words : 1U); i++) {
+        _lossy_data[i].store(0U, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Register(size_t &consumer) {
+    for (size_t i = 0; i < max_consumers; i++) {
+        bool active = false;
+        if (!_consumers[i].active.compare_exchange_strong(active, true)) {
+            continue;
+        }
+
+        _consumers[i].overrun = 0U;
+
+        /*
+           Pairs with the fence in CalcLimit(). Either the producer sees this
+           consumer as active, or this sees every write the producer did
+           before it last checked the consumers, so the consumer can not start
+           at data the producer is already allowed to overwrite. Until the read
+           cursor is stored, the producer sees an older, more conservative one.
+         */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        _consumers[i].r.store(_w.load(std::memory_order_acquire),
+                              std::memory_order_release);
+
+        consumer = i;
+        return true;
+    }
+
+    return false;
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::Unregister(
+    const size_t consumer) {
+    assert(consumer < max_consumers);
+
+    _consumers[consumer].active.store(false, std::memory_order_release);
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Write(const T *data,
+                                                        const size_t cnt) {
+    if (cnt > size) {
+        return false;
+    }
+
+    const size_t w = _w.load(std::memory_order_relaxed);
+
+    if (lossy) {
+        /* Let the consumers detect the data being overwritten */
+        _claim.store(w + cnt, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    } else if (_limit - w < cnt) {
+        /* Only look at the consumers once the cached limit is reached */
+        _limit = CalcLimit(w);
+        if (_limit - w < cnt) {
+            return false;
+        }
+    }
+
+    CopyIn(w & (size - 1U), data, cnt, std::integral_constant<bool, lossy>());
+
+    /* Store the write cursor with adequate ordering */
+    _w.store(w + cnt, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Read(const size_t consumer,
+                                                       T *data,
+                                                       const size_t cnt) {
+    assert(consumer < max_consumers);
+
+    /* Preload variables with adequate memory ordering */
+    const size_t r = _consumers[consumer].r.load(std::memory_order_relaxed);
+    const size_t w = _w.load(std::memory_order_acquire);
+
+    if (lossy && w - r > size) {
+        OnOverrun(consumer, r);
+        return false;
+    }
+
+    if (w - r < cnt) {
+        return false;
+    }
+
+    CopyOut(data, r & (size - 1U), cnt, std::integral_constant<bool, lossy>());
+
+    if (lossy) {
+        /* Check whether the producer started overwriting while copying */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_claim.load(std::memory_order_relaxed) - r > size) {
+            OnOverrun(consumer, r);
+            return false;
+        }
+    }
+
+    /* Store the read cursor with adequate ordering */
+    _consumers[consumer].r.store(r + cnt, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+size_t BroadcastBuf<T, size, max_consumers, lossy>::GetAvailable(
+    const size_t consumer) const {
+    assert(consumer < max_consumers);
+
+    const size_t r = _consumers[consumer].r.load(std::memory_order_relaxed);
+    const size_t w = _w.load(std::memory_order_acquire);
+
+    /* An overrun consumer can not have more than the whole buffer */
+    return (w - r > size) ? size : w - r;
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+size_t BroadcastBuf<T, size, max_consumers, lossy>::GetOverrun(
+    const size_t consumer) const {
+    assert(consumer < max_consumers);
+
+    return _consumers[consumer].overrun;
+}
+
+/********************** std::array API ************************/
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+template <size_t arr_size>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Write(
+    const std::array<T, arr_size> &data) {
+    return Write(data.data(), arr_size);
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+template <size_t arr_size>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Read(
+    const size_t consumer, std::array<T, arr_size> &data) {
+    return Read(consumer, data.data(), arr_size);
+}
+
+/********************** std::span API *************************/
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Write(
+    std::span<const T> data) {
+    return Write(data.data(), data.size());
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+bool BroadcastBuf<T, size, max_consumers, lossy>::Read(const size_t consumer,
+                                                       std::span<T> data) {
+    return Read(consumer, data.data(), data.size());
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+size_t BroadcastBuf<T, size, max_consumers, lossy>::CalcLimit(
+    const size_t w) const {
+    /* Pairs with the fence in Register() */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    /* The producer can write up to a buffer ahead of the slowest consumer */
+    size_t max_lag = 0U;
+    for (size_t i = 0; i < max_consumers; i++) {
+        if (!_consumers[i].active.load(std::memory_order_acquire)) {
+            continue;
+        }
+        const size_t lag =
+            w - _consumers[i].r.load(std::memory_order_acquire);
+        if (lag > max_lag) {
+            max_lag = lag;
+        }
+    }
+
+    if (max_lag >= size) {
+        return w;
+    }
+    return w + (size - max_lag);
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::OnOverrun(
+    const size_t consumer, const size_t r) {
+    /* Skip to the oldest data the producer is not overwriting */
+    const size_t oldest = _claim.load(std::memory_order_relaxed) - size;
+
+    _consumers[consumer].overrun += oldest - r;
+    _consumers[consumer].r.store(oldest, std::memory_order_relaxed);
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::CopyIn(const size_t idx,
+                                                         const T *data,
+                                                         const size_t cnt,
+                                                         std::false_type) {
+    /* Check if the write wraps */
+    if (idx + cnt <= size) {
+        /* Copy in the linear region */
+        memcpy(&_data[idx], &data[0], cnt * sizeof(T));
+    } else {
+        /* Copy in the linear region */
+        const size_t linear_free = size - idx;
+        memcpy(&_data[idx], &data[0], linear_free * sizeof(T));
+        /* Copy remaining to the beginning of the buffer */
+        const size_t remaining = cnt - linear_free;
+        memcpy(&_data[0], &data[linear_free], remaining * sizeof(T));
+    }
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::CopyIn(const size_t idx,
+                                                         const T *data,
+                                                         const size_t cnt,
+                                                         std::true_type) {
+    /*
+       Consumers can be copying the data being overwritten, so it is copied
+       through relaxed atomics like in the SeqLock, which keeps it free of data
+       races while still compiling to plain word sized moves.
+     */
+    for (size_t i = 0; i < cnt; i++) {
+        size_t words[_words] = {};
+        memcpy(words, &data[i], sizeof(T));
+
+        const size_t slot = ((idx + i) & (size - 1U)) * _words;
+        for (size_t j = 0; j < _words; j++) {
+            _lossy_data[slot + j].store(words[j], std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::CopyOut(
+    T *data, const size_t idx, const size_t cnt, std::false_type) const {
+    /* Check if the read wraps */
+    if (idx + cnt <= size) {
+        /* Copy in the linear region */
+        memcpy(&data[0], &_data[idx], cnt * sizeof(T));
+    } else {
+        /* Copy in the linear region */
+        const size_t linear_available = size - idx;
+        memcpy(&data[0], &_data[idx], linear_available * sizeof(T));
+        /* Copy remaining from the beginning of the buffer */
+        const size_t remaining = cnt - linear_available;
+        memcpy(&data[linear_available], &_data[0], remaining * sizeof(T));
+    }
+}
+
+template <typename T, size_t size, size_t max_consumers, bool lossy>
+void BroadcastBuf<T, size, max_consumers, lossy>::CopyOut(
+    T *data, const size_t idx, const size_t cnt, std::true_type) const {
+    for (size_t i = 0; i < cnt; i++) {
+        size_t words[_words];
+
+        const size_t slot = ((idx + i) & (size - 1U)) * _words;
+        for (size_t j = 0; j < _words; j++) {
+            words[j] = _lossy_data[slot + j].load(std::memory_order_relaxed);
+        }
+
+        memcpy(&data[i], words, sizeof(T));
+    }
+}
+
+} /* namespace spmc */
+} /* namespace lockfree */
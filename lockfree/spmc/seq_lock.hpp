@@ -0,0 +1,104 @@
+/**************************************************************
+ * @file seq_lock.hpp
+ * @brief A sequence lock implementation written in standard
+ * c++11, sharing a value from a single writer with many
+ * readers. Wait-free for the writer, lock-free for readers.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_SEQ_LOCK_HPP
+#define LOCKFREE_SEQ_LOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace lockfree {
+namespace spmc {
+/*************************** TYPES ****************************/
+
+template <typename T> class SeqLock {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    SeqLock();
+
+    /**
+     * @brief Writes a new value.
+     * Should only be called from the writer thread.
+     * @param[in] element
+     */
+    void Write(const T &element);
+
+    /**
+     * @brief Reads the value, retrying for as long as the writer modifies it
+     * during the read.
+     * Can be called from any number of reader threads.
+     * @param[out] element
+     */
+    void Read(T &element) const;
+
+    /**
+     * @brief Attempts to read the value once.
+     * Can be called from any number of reader threads.
+     * @param[out] element
+     * @retval Operation success, false if the writer modified the value during
+     * the read
+     */
+    bool TryRead(T &element) const;
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr size_t _words =
+        (sizeof(T) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _seq; /**< Odd while a write is in progress */
+#else
+    std::atomic_size_t _seq; /**< Odd while a write is in progress */
+#endif
+    std::atomic_size_t _data[_words]; /**< The value, copied word by word */
+};
+
+} /* namespace spmc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "seq_lock_impl.hpp"
+
+#endif /* LOCKFREE_SEQ_LOCK_HPP */
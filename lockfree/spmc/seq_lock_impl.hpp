@@ -0,0 +1,98 @@
+/**************************************************************
+ * @file seq_lock_impl.hpp
+ * @brief A sequence lock implementation written in standard
+ * c++11, sharing a value from a single writer with many
+ * readers. Wait-free for the writer, lock-free for readers.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+#include <cstring>
+
+namespace lockfree {
+namespace spmc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T> SeqLock<T>::SeqLock() : _seq(0U) {
+    for (size_t i = 0; i < _words; i++) {
+        _data[i].store(0U, std::memory_order_relaxed);
+    }
+}
+
+template <typename T> void SeqLock<T>::Write(const T &element) {
+    size_t words[_words] = {};
+    memcpy(words, &element, sizeof(T));
+
+    const size_t seq = _seq.load(std::memory_order_relaxed);
+    _seq.store(seq + 1U, std::memory_order_relaxed);
+    /* Keeps the data stores from becoming visible before the odd sequence */
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /*
+       Copying through relaxed atomics keeps the concurrent reads free of data
+       races, while still compiling to plain word sized moves.
+     */
+    for (size_t i = 0; i < _words; i++) {
+        _data[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    _seq.store(seq + 2U, std::memory_order_release);
+}
+
+template <typename T> void SeqLock<T>::Read(T &element) const {
+    while (!TryRead(element)) {
+    }
+}
+
+template <typename T> bool SeqLock<T>::TryRead(T &element) const {
+    const size_t seq = _seq.load(std::memory_order_acquire);
+    if ((seq & 1U) != 0U) {
+        return false;
+    }
+
+    size_t words[_words];
+    for (size_t i = 0; i < _words; i++) {
+        words[i] = _data[i].load(std::memory_order_relaxed);
+    }
+
+    /* Keeps the data loads from being reordered after the sequence check */
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_seq.load(std::memory_order_relaxed) != seq) {
+        return false;
+    }
+
+    memcpy(&element, words, sizeof(T));
+    return true;
+}
+
+} /* namespace spmc */
+} /* namespace lockfree */
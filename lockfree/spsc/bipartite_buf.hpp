@@ -46,6 +46,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "../trace.hpp"
+
 #if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
 #include <span>
 #endif
@@ -80,6 +82,27 @@ template <typename T, size_t size> class BipartiteBuf {
     std::span<T> WriteAcquireSpan(size_t free_required);
 #endif
 
+    /**
+     * @brief Acquires the largest linear region in the bipartite buffer for
+     * writing, useful when the amount of data to write is not known upfront.
+     * Should only be called from the producer thread.
+     * @param[in] Minimum free linear space in the buffer required
+     * @retval Pair containing the pointer to the beginning of the linear
+     * space and its size, nullptr if there is not enough space
+     */
+    std::pair<T *, size_t> WriteAcquireMax(size_t min_required);
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    /**
+     * @brief Acquires the largest linear region in the bipartite buffer for
+     * writing, useful when the amount of data to write is not known upfront.
+     * Should only be called from the producer thread.
+     * @param[in] Minimum free linear space in the buffer required
+     * @retval Span of the linear space
+     */
+    std::span<T> WriteAcquireMaxSpan(size_t min_required);
+#endif
+
     /**
      * @brief Releases the bipartite buffer after a write
      * Should only be called from the producer thread.
@@ -69,13 +69,49 @@ T *BipartiteBuf<T, size>::WriteAcquire(const size_t free_required) {
     const size_t free_from_start = free - linear_free;
     if (free_required <= free_from_start) {
         _write_wrapped = true;
+        LOCKFREE_TRACE(bipartite_buf_wrap, this, w, free_from_start);
         return &_data[0];
     }
 
     /* Could not find free linear space with required size */
+    LOCKFREE_TRACE(bipartite_buf_write_full, this, free_required, free);
     return nullptr;
 }
 
+template <typename T, size_t size>
+std::pair<T *, size_t>
+BipartiteBuf<T, size>::WriteAcquireMax(const size_t min_required) {
+    /* Preload variables with adequate memory ordering */
+    const size_t w = _w.load(std::memory_order_relaxed);
+    const size_t r = _r.load(std::memory_order_acquire);
+
+    const size_t free = CalcFree(w, r);
+    const size_t linear_space = size - w;
+    const size_t linear_free = std::min(free, linear_space);
+    const size_t free_from_start = free - linear_free;
+
+    /* Prefer the space until the end of the buffer when it is at least as
+     * big, as wrapping invalidates it */
+    if (linear_free >= free_from_start) {
+        if (linear_free == 0U || linear_free < min_required) {
+            LOCKFREE_TRACE(bipartite_buf_write_full, this, min_required,
+                           linear_free);
+            return std::make_pair(nullptr, 0U);
+        }
+        _write_wrapped = false;
+        return std::make_pair(&_data[w], linear_free);
+    }
+
+    if (free_from_start < min_required) {
+        LOCKFREE_TRACE(bipartite_buf_write_full, this, min_required,
+                       free_from_start);
+        return std::make_pair(nullptr, 0U);
+    }
+    _write_wrapped = true;
+    LOCKFREE_TRACE(bipartite_buf_wrap, this, w, free_from_start);
+    return std::make_pair(&_data[0], free_from_start);
+}
+
 template <typename T, size_t size>
 void BipartiteBuf<T, size>::WriteRelease(const size_t written) {
     size_t w = _w.load(std::memory_order_relaxed);
@@ -109,6 +145,7 @@ void BipartiteBuf<T, size>::WriteRelease(const size_t written) {
     /* Store the indexes with adequate memory ordering */
     _i.store(i, std::memory_order_relaxed);
     _w.store(w, std::memory_order_release);
+    LOCKFREE_TRACE(bipartite_buf_write_release, this, written, w);
 }
 
 template <typename T, size_t size>
@@ -119,6 +156,7 @@ std::pair<T *, size_t> BipartiteBuf<T, size>::ReadAcquire() {
 
     /* When read and write indexes are equal, the buffer is empty */
     if (r == w) {
+        LOCKFREE_TRACE(bipartite_buf_read_empty, this, r, w);
         return std::make_pair(nullptr, 0U);
     }
 
@@ -131,6 +169,7 @@ std::pair<T *, size_t> BipartiteBuf<T, size>::ReadAcquire() {
     const size_t i = _i.load(std::memory_order_relaxed);
     if (r == i) {
         _read_wrapped = true;
+        LOCKFREE_TRACE(bipartite_buf_invalidate, this, r, w);
         return std::make_pair(&_data[0], w);
     }
 
@@ -158,6 +197,7 @@ void BipartiteBuf<T, size>::ReadRelease(const size_t read) {
 
     /* Store the indexes with adequate memory ordering */
     _r.store(r, std::memory_order_release);
+    LOCKFREE_TRACE(bipartite_buf_read_release, this, read, r);
 }
 
 /********************** std::span API *************************/
@@ -173,6 +213,13 @@ BipartiteBuf<T, size>::WriteAcquireSpan(const size_t free_required) {
     }
 }
 
+template <typename T, size_t size>
+std::span<T>
+BipartiteBuf<T, size>::WriteAcquireMaxSpan(const size_t min_required) {
+    auto res = WriteAcquireMax(min_required);
+    return {res.first, res.second};
+}
+
 template <typename T, size_t size>
 std::span<T> BipartiteBuf<T, size>::ReadAcquireSpan() {
     auto res = ReadAcquire();
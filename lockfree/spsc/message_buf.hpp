@@ -0,0 +1,167 @@
+/**************************************************************
+ * @file message_buf.hpp
+ * @brief A message buffer implementation written in
+ * standard c++11 suitable for all systems, from low-end
+ * microcontrollers to HPC machines.
+ * Lock-free for single consumer single producer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_MESSAGE_BUF_HPP
+#define LOCKFREE_MESSAGE_BUF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
+
+#include "bipartite_buf.hpp"
+
+namespace lockfree {
+namespace spsc {
+/*************************** TYPES ****************************/
+
+template <size_t size, size_t alignment = sizeof(size_t)> class MessageBuf {
+    static_assert(alignment >= sizeof(size_t),
+                  "Alignment must be able to hold the message length");
+    static_assert((alignment & (alignment - 1)) == 0,
+                  "Alignment must be a power of 2");
+    static_assert(size % alignment == 0,
+                  "Buffer size must be a multiple of the alignment");
+    static_assert(size / alignment > 2,
+                  "Buffer size must be bigger than 2 alignment units");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    MessageBuf();
+
+    /**
+     * @brief Reserves linear space for a message in the buffer.
+     * Should only be called from the producer thread.
+     * @param[in] Maximum size of the message in bytes
+     * @retval Pointer to the aligned message payload, nullptr if no space
+     */
+    uint8_t *Reserve(size_t bytes);
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    /**
+     * @brief Reserves linear space for a message in the buffer.
+     * Should only be called from the producer thread.
+     * @param[in] Maximum size of the message in bytes
+     * @retval Span of the aligned message payload, empty if no space
+     */
+    std::span<uint8_t> ReserveSpan(size_t bytes);
+#endif
+
+    /**
+     * @brief Commits the whole reserved space as a message.
+     * Should only be called from the producer thread.
+     * @retval None
+     */
+    void Commit();
+
+    /**
+     * @brief Commits a message shorter than the reserved space.
+     * Should only be called from the producer thread.
+     * @param[in] Size of the message in bytes, at most the reserved size
+     * @retval None
+     */
+    void Commit(size_t bytes);
+
+    /**
+     * @brief Gets the oldest message in the buffer without removing it.
+     * Messages already made visible are iterated without touching the
+     * producer index again. Should only be called from the consumer thread.
+     * @retval Pair containing the pointer to the message payload and its
+     * size in bytes, nullptr if the buffer is empty
+     */
+    std::pair<uint8_t *, size_t> Front();
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    /**
+     * @brief Gets the oldest message in the buffer without removing it.
+     * Should only be called from the consumer thread.
+     * @retval Span of the message payload, with a nullptr data pointer if
+     * the buffer is empty
+     */
+    std::span<uint8_t> FrontSpan();
+#endif
+
+    /**
+     * @brief Removes the oldest message from the buffer.
+     * Should only be called from the consumer thread.
+     * @retval Operation success
+     */
+    bool Pop();
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct alignas(alignment) Block {
+        uint8_t bytes[alignment];
+    };
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    static size_t CalcBlocks(size_t bytes);
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    BipartiteBuf<Block, size / alignment> _buf; /**< Underlying storage */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        Block *_write_header; /**< Reserved message header, producer only */
+    size_t _reserved;         /**< Reserved payload size, producer only */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        Block *_read_header; /**< Current message header, consumer only */
+    size_t _read_blocks;     /**< Acquired blocks left, consumer only */
+#else
+    Block *_write_header; /**< Reserved message header, producer only */
+    size_t _reserved;     /**< Reserved payload size, producer only */
+    Block *_read_header;  /**< Current message header, consumer only */
+    size_t _read_blocks;  /**< Acquired blocks left, consumer only */
+#endif
+};
+
+} /* namespace spsc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "message_buf_impl.hpp"
+
+#endif /* LOCKFREE_MESSAGE_BUF_HPP */
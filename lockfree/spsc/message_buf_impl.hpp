@@ -0,0 +1,157 @@
+/**************************************************************
+ * @file message_buf_impl.hpp
+ * @brief A message buffer implementation written in standard
+ * c++11 suitable for both low-end microcontrollers all the way
+ * to HPC machines. Lock-free for single consumer single
+ * producer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <cassert>
+#include <cstring>
+
+namespace lockfree {
+namespace spsc {
+/********************** PUBLIC METHODS ************************/
+
+template <size_t size, size_t alignment>
+MessageBuf<size, alignment>::MessageBuf()
+    : _write_header(nullptr), _reserved(0U), _read_header(nullptr),
+      _read_blocks(0U) {}
+
+template <size_t size, size_t alignment>
+uint8_t *MessageBuf<size, alignment>::Reserve(const size_t bytes) {
+    /* Guard against the block count calculation overflowing */
+    if (bytes > size) {
+        return nullptr;
+    }
+
+    Block *header = _buf.WriteAcquire(CalcBlocks(bytes));
+    if (header == nullptr) {
+        return nullptr;
+    }
+
+    _write_header = header;
+    _reserved = bytes;
+
+    /* The payload starts at the first block after the header */
+    return reinterpret_cast<uint8_t *>(header + 1);
+}
+
+template <size_t size, size_t alignment>
+void MessageBuf<size, alignment>::Commit() {
+    Commit(_reserved);
+}
+
+template <size_t size, size_t alignment>
+void MessageBuf<size, alignment>::Commit(const size_t bytes) {
+    assert(_write_header != nullptr);
+    assert(bytes <= _reserved);
+
+    /* Write the length header, the release in WriteRelease publishes it */
+    memcpy(_write_header->bytes, &bytes, sizeof(bytes));
+    _write_header = nullptr;
+
+    _buf.WriteRelease(CalcBlocks(bytes));
+}
+
+template <size_t size, size_t alignment>
+std::pair<uint8_t *, size_t> MessageBuf<size, alignment>::Front() {
+    /* Only acquire from the producer when all previously acquired messages
+     * have been consumed */
+    if (_read_blocks == 0U) {
+        const std::pair<Block *, size_t> read = _buf.ReadAcquire();
+        if (read.second == 0U) {
+            return std::make_pair(nullptr, 0U);
+        }
+        _read_header = read.first;
+        _read_blocks = read.second;
+    }
+
+    size_t bytes;
+    memcpy(&bytes, _read_header->bytes, sizeof(bytes));
+
+    return std::make_pair(reinterpret_cast<uint8_t *>(_read_header + 1),
+                          bytes);
+}
+
+template <size_t size, size_t alignment>
+bool MessageBuf<size, alignment>::Pop() {
+    const std::pair<uint8_t *, size_t> message = Front();
+    if (message.first == nullptr) {
+        return false;
+    }
+
+    /* Release the message space back to the producer right away, the rest of
+     * the acquired region stays cached for the following messages */
+    const size_t blocks = CalcBlocks(message.second);
+    assert(blocks <= _read_blocks);
+    _buf.ReadRelease(blocks);
+    _read_header += blocks;
+    _read_blocks -= blocks;
+
+    return true;
+}
+
+/********************** std::span API *************************/
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+template <size_t size, size_t alignment>
+std::span<uint8_t>
+MessageBuf<size, alignment>::ReserveSpan(const size_t bytes) {
+    auto res = Reserve(bytes);
+    if (res) {
+        return {res, bytes};
+    } else {
+        return {res, 0};
+    }
+}
+
+template <size_t size, size_t alignment>
+std::span<uint8_t> MessageBuf<size, alignment>::FrontSpan() {
+    auto res = Front();
+    return {res.first, res.second};
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <size_t size, size_t alignment>
+size_t MessageBuf<size, alignment>::CalcBlocks(const size_t bytes) {
+    /* One block for the length header and the payload rounded up */
+    return 1U + (bytes + alignment - 1U) / alignment;
+}
+
+} /* namespace spsc */
+} /* namespace lockfree */
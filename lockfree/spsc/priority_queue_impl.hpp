@@ -66,6 +66,33 @@ bool PriorityQueue<T, size, priority_count>::Pop(T &element) {
     return false;
 }
 
+template <typename T, size_t size, size_t priority_count>
+size_t PriorityQueue<T, size, priority_count>::SizeApprox() const {
+    size_t count = 0U;
+    for (size_t priority = 0U; priority < priority_count; priority++) {
+        count += _subqueue[priority].SizeApprox();
+    }
+    return count;
+}
+
+template <typename T, size_t size, size_t priority_count>
+bool PriorityQueue<T, size, priority_count>::EmptyApprox() const {
+    for (size_t priority = 0U; priority < priority_count; priority++) {
+        if (!_subqueue[priority].EmptyApprox()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, size_t size, size_t priority_count>
+bool PriorityQueue<T, size, priority_count>::FullApprox(
+    const size_t priority) const {
+    assert(priority < priority_count);
+
+    return _subqueue[priority].FullApprox();
+}
+
 /********************* std::optional API **********************/
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
 template <typename T, size_t size, size_t priority_count>
@@ -45,6 +45,9 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../stats.hpp"
+#include "../trace.hpp"
+
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
 #include <optional>
 #endif
@@ -53,7 +56,8 @@ namespace lockfree {
 namespace spsc {
 /*************************** TYPES ****************************/
 
-template <typename T, size_t size> class Queue {
+template <typename T, size_t size, typename StatsPolicy = NoStats>
+class Queue : private StatsPolicy {
     static_assert(std::is_trivial<T>::value, "The type T must be trivial");
     static_assert(size > 2, "Buffer size must be bigger than 2");
 
@@ -86,6 +90,38 @@ template <typename T, size_t size> class Queue {
     std::optional<T> Pop();
 #endif
 
+    /**
+     * @brief Reads the event counters of the queue, all zero unless the queue
+     * was instantiated with the Stats policy.
+     * Can be called from any thread.
+     * @retval Counter snapshot
+     */
+    StatsSnapshot GetStats() const;
+
+    /**
+     * @brief Estimates the number of elements in the queue.
+     * Should only be called from the producer or the consumer thread, does
+     * not synchronize with the other one. Called from the producer thread the
+     * real count can only be lower, called from the consumer thread it can
+     * only be higher.
+     * @retval Element count, between 0 and size - 1
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if the queue is empty, with the same consistency as
+     * SizeApprox().
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /**
+     * @brief Estimates if the queue is full, with the same consistency as
+     * SizeApprox().
+     * @retval Whether the queue appears full
+     */
+    bool FullApprox() const;
+
     /********************** PRIVATE MEMBERS ***********************/
   private:
     T _data[size]; /**< Data array */
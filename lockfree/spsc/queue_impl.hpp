@@ -41,9 +41,11 @@ namespace lockfree {
 namespace spsc {
 /********************** PUBLIC METHODS ************************/
 
-template <typename T, size_t size> Queue<T, size>::Queue() : _r(0U), _w(0U) {}
+template <typename T, size_t size, typename StatsPolicy>
+Queue<T, size, StatsPolicy>::Queue() : _r(0U), _w(0U) {}
 
-template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::Push(const T &element) {
     /*
        The full check needs to be performed using the next write index not to
        miss the case when the read index wrapped and write index is at the end
@@ -57,6 +59,8 @@ template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
     /* Full check  */
     const size_t r = _r.load(std::memory_order_acquire);
     if (w_next == r) {
+        StatsPolicy::OnPushFull();
+        LOCKFREE_TRACE(spsc_queue_push_full, this, w, r);
         return false;
     }
 
@@ -65,16 +69,25 @@ template <typename T, size_t size> bool Queue<T, size>::Push(const T &element) {
 
     /* Store the next write index */
     _w.store(w_next, std::memory_order_release);
+    LOCKFREE_TRACE(spsc_queue_push, this, w_next, r);
+
+    /* The read index may be stale, so the count is an upper bound */
+    if (StatsPolicy::enabled) {
+        StatsPolicy::OnPushed(w_next >= r ? w_next - r : w_next + size - r);
+    }
     return true;
 }
 
-template <typename T, size_t size> bool Queue<T, size>::Pop(T &element) {
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::Pop(T &element) {
     /* Preload indexes with adequate memory ordering */
     size_t r = _r.load(std::memory_order_relaxed);
     const size_t w = _w.load(std::memory_order_acquire);
 
     /* Empty check */
     if (r == w) {
+        StatsPolicy::OnPopEmpty();
+        LOCKFREE_TRACE(spsc_queue_pop_empty, this, w, r);
         return false;
     }
 
@@ -89,12 +102,47 @@ template <typename T, size_t size> bool Queue<T, size>::Pop(T &element) {
 
     /* Store the read index */
     _r.store(r, std::memory_order_release);
+    LOCKFREE_TRACE(spsc_queue_pop, this, w, r);
     return true;
 }
 
+template <typename T, size_t size, typename StatsPolicy>
+StatsSnapshot Queue<T, size, StatsPolicy>::GetStats() const {
+    return StatsPolicy::GetSnapshot();
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+size_t Queue<T, size, StatsPolicy>::SizeApprox() const {
+    const size_t w = _w.load(std::memory_order_relaxed);
+    const size_t r = _r.load(std::memory_order_relaxed);
+
+    /*
+       One of the indexes is owned by the calling thread, so the other one can
+       only be stale in the direction that keeps the result in range. From any
+       other thread, a stale write index can not be told apart from a wrapped
+       one, and the result can be anything up to size - 1.
+     */
+    if (w >= r) {
+        return w - r;
+    } else {
+        return size - (r - w);
+    }
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::EmptyApprox() const {
+    return SizeApprox() == 0U;
+}
+
+template <typename T, size_t size, typename StatsPolicy>
+bool Queue<T, size, StatsPolicy>::FullApprox() const {
+    return SizeApprox() == size - 1U;
+}
+
 /********************* std::optional API **********************/
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
-template <typename T, size_t size> std::optional<T> Queue<T, size>::Pop() {
+template <typename T, size_t size, typename StatsPolicy>
+std::optional<T> Queue<T, size, StatsPolicy>::Pop() {
     T element;
     bool result = Pop(element);
 
@@ -46,6 +46,8 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "../trace.hpp"
+
 #if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
 #include <span>
 #endif
@@ -53,6 +53,7 @@ bool RingBuf<T, size>::Write(const T *data, const size_t cnt) {
     const size_t r = _r.load(std::memory_order_acquire);
 
     if (CalcFree(w, r) < cnt) {
+        LOCKFREE_TRACE(ring_buf_write_full, this, cnt, CalcFree(w, r));
         return false;
     }
 
@@ -78,6 +79,7 @@ bool RingBuf<T, size>::Write(const T *data, const size_t cnt) {
 
     /* Store the write index with adequate ordering */
     _w.store(w, std::memory_order_release);
+    LOCKFREE_TRACE(ring_buf_write, this, cnt, w);
 
     return true;
 }
@@ -89,6 +91,7 @@ bool RingBuf<T, size>::Read(T *data, const size_t cnt) {
     const size_t w = _w.load(std::memory_order_acquire);
 
     if (CalcAvailable(w, r) < cnt) {
+        LOCKFREE_TRACE(ring_buf_read_empty, this, cnt, CalcAvailable(w, r));
         return false;
     }
 
@@ -114,6 +117,7 @@ bool RingBuf<T, size>::Read(T *data, const size_t cnt) {
 
     /* Store the write index with adequate ordering */
     _r.store(r, std::memory_order_release);
+    LOCKFREE_TRACE(ring_buf_read, this, cnt, r);
 
     return true;
 }
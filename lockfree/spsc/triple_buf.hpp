@@ -0,0 +1,149 @@
+/**************************************************************
+ * @file triple_buf.hpp
+ * @brief A triple buffer implementation written in standard
+ * c++11 suitable for all systems, from low-end
+ * microcontrollers to HPC machines. Always provides the latest
+ * value. Wait-free for single consumer single producer
+ * scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_TRIPLE_BUF_HPP
+#define LOCKFREE_TRIPLE_BUF_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace lockfree {
+namespace spsc {
+/*************************** TYPES ****************************/
+
+template <typename T> class TripleBuf {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    TripleBuf();
+
+    /**
+     * @brief Writes a new value, replacing the previous one even if it was
+     * never read.
+     * Should only be called from the producer thread.
+     * @param[in] element
+     */
+    void Write(const T &element);
+
+    /**
+     * @brief Acquires the buffer to write the next value into in place. The
+     * buffer holds an older value, not necessarily the latest one.
+     * Should only be called from the producer thread.
+     * @retval Pointer to the buffer
+     */
+    T *WriteAcquire();
+
+    /**
+     * @brief Publishes the value written into the acquired buffer.
+     * Should only be called from the producer thread.
+     * @retval None
+     */
+    void WriteRelease();
+
+    /**
+     * @brief Reads the latest value.
+     * Should only be called from the consumer thread.
+     * @param[out] element
+     * @retval Whether the value is new since the last read
+     */
+    bool Read(T &element);
+
+    /**
+     * @brief Acquires the latest value for reading in place. The value stays
+     * valid until the next read.
+     * Should only be called from the consumer thread.
+     * @retval Pointer to the latest value
+     */
+    const T *ReadAcquire();
+
+    /**
+     * @brief Checks if a new value was written since the last read.
+     * Should only be called from the consumer thread.
+     * @retval Whether a new value is available
+     */
+    bool HasNew() const;
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    bool Swap();
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) Slot {
+#else
+    struct Slot {
+#endif
+        T val;
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    static constexpr uint8_t _index_mask = 0x03U;
+    static constexpr uint8_t _new_flag = 0x04U; /**< Middle buffer is new */
+
+    Slot _data[3]; /**< Back, middle and front buffers */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic<uint8_t> _middle; /**< Middle buffer index and flag */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        uint8_t _back; /**< Buffer owned by the producer */
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        uint8_t _front; /**< Buffer owned by the consumer */
+#else
+    std::atomic<uint8_t> _middle; /**< Middle buffer index and flag */
+    uint8_t _back;               /**< Buffer owned by the producer */
+    uint8_t _front;              /**< Buffer owned by the consumer */
+#endif
+};
+
+} /* namespace spsc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "triple_buf_impl.hpp"
+
+#endif /* LOCKFREE_TRIPLE_BUF_HPP */
@@ -0,0 +1,101 @@
+/**************************************************************
+ * @file triple_buf_impl.hpp
+ * @brief A triple buffer implementation written in standard
+ * c++11 suitable for all systems, from low-end
+ * microcontrollers to HPC machines. Always provides the latest
+ * value. Wait-free for single consumer single producer
+ * scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+namespace lockfree {
+namespace spsc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T>
+TripleBuf<T>::TripleBuf() : _data(), _middle(1U), _back(0U), _front(2U) {}
+
+template <typename T> void TripleBuf<T>::Write(const T &element) {
+    _data[_back].val = element;
+    WriteRelease();
+}
+
+template <typename T> T *TripleBuf<T>::WriteAcquire() {
+    return &_data[_back].val;
+}
+
+template <typename T> void TripleBuf<T>::WriteRelease() {
+    /*
+       Swap the written buffer with the middle one, release makes the value
+       visible to the consumer, while acquire makes sure the consumer is done
+       with the buffer handed back if it was swapped in by the consumer.
+     */
+    const uint8_t middle = _middle.exchange(
+        static_cast<uint8_t>(_back | _new_flag), std::memory_order_acq_rel);
+    _back = middle & _index_mask;
+}
+
+template <typename T> bool TripleBuf<T>::Read(T &element) {
+    const bool fresh = Swap();
+    element = _data[_front].val;
+
+    return fresh;
+}
+
+template <typename T> const T *TripleBuf<T>::ReadAcquire() {
+    Swap();
+
+    return &_data[_front].val;
+}
+
+template <typename T> bool TripleBuf<T>::HasNew() const {
+    return (_middle.load(std::memory_order_relaxed) & _new_flag) != 0U;
+}
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T> bool TripleBuf<T>::Swap() {
+    /* Keep the current buffer if there is nothing new to swap it for */
+    if (!HasNew()) {
+        return false;
+    }
+
+    const uint8_t middle =
+        _middle.exchange(_front, std::memory_order_acq_rel);
+    _front = middle & _index_mask;
+
+    return true;
+}
+
+} /* namespace spsc */
+} /* namespace lockfree */
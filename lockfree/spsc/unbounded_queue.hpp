@@ -0,0 +1,165 @@
+/**************************************************************
+ * @file unbounded_queue.hpp
+ * @brief An unbounded queue implementation written in standard
+ * c++11 built from linked, recycled segments. Lock-free and
+ * wait-free for the consumer in single-producer single-
+ * consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_SPSC_UNBOUNDED_QUEUE_HPP
+#define LOCKFREE_SPSC_UNBOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <optional>
+#endif
+
+#include "../lockfree.hpp"
+
+namespace lockfree {
+namespace spsc {
+/*************************** TYPES ****************************/
+
+template <typename T, size_t segment_size> class UnboundedQueue {
+    static_assert(std::is_trivial<T>::value, "The type T must be trivial");
+    static_assert(segment_size > 2, "Segment size must be bigger than 2");
+
+    /********************** PUBLIC METHODS ************************/
+  public:
+    UnboundedQueue();
+
+    /**
+     * @brief Frees all segments.
+     */
+    ~UnboundedQueue();
+
+    UnboundedQueue(const UnboundedQueue &) = delete;
+    UnboundedQueue &operator=(const UnboundedQueue &) = delete;
+
+    /**
+     * @brief Adds an element into the queue, linking in a segment drained by
+     * the consumer, or a new one if there is none, when the last segment is
+     * full.
+     * Should only be called from the producer thread.
+     * @param[in] element
+     * @retval Operation success, false only if a segment could not be
+     * allocated
+     */
+    bool Push(const T &element);
+
+    /**
+     * @brief Removes an element from the queue, in a bounded number of steps.
+     * Should only be called from the consumer thread.
+     * @param[out] element
+     * @retval Operation success
+     */
+    bool Pop(T &element);
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /**
+     * @brief Removes an element from the queue, in a bounded number of steps.
+     * Should only be called from the consumer thread.
+     * @retval Either the element or nothing
+     */
+    std::optional<T> Pop();
+#endif
+
+    /**
+     * @brief Estimates the number of elements in the queue.
+     * Can be called from any thread, does not synchronize with it. Called from
+     * the producer thread the real count can only be lower, called from the
+     * consumer thread it can only be higher.
+     * @retval Element count
+     */
+    size_t SizeApprox() const;
+
+    /**
+     * @brief Estimates if the queue is empty, with the same consistency as
+     * SizeApprox().
+     * @retval Whether the queue appears empty
+     */
+    bool EmptyApprox() const;
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+    struct Segment {
+        T data[segment_size];
+        std::atomic<Segment *> next; /**< Only written by the producer */
+        bool embedded;               /**< Part of the queue, never freed */
+    };
+
+    /********************* PRIVATE METHODS ************************/
+  private:
+    Segment *AcquireSegment();
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    Segment _first_segment; /**< Embedded, so construction cannot fail */
+
+    /* Producer side */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _w_count; /**< Elements pushed */
+#else
+    std::atomic_size_t _w_count; /**< Elements pushed */
+#endif
+    Segment *_tail;      /**< Segment being pushed to */
+    size_t _w;           /**< Write index in the tail segment */
+    Segment *_first;     /**< Oldest segment, drained up to _head_cache */
+    Segment *_head_cache; /**< Last seen segment of the consumer */
+
+    /* Consumer side */
+#if LOCKFREE_CACHE_COHERENT
+    alignas(LOCKFREE_CACHELINE_LENGTH)
+        std::atomic_size_t _r_count; /**< Elements popped */
+#else
+    std::atomic_size_t _r_count; /**< Elements popped */
+#endif
+    std::atomic<Segment *> _head; /**< Segment being popped from */
+    size_t _r;                    /**< Read index in the head segment */
+};
+
+} /* namespace spsc */
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "unbounded_queue_impl.hpp"
+
+#endif /* LOCKFREE_SPSC_UNBOUNDED_QUEUE_HPP */
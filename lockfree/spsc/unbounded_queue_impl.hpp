@@ -0,0 +1,191 @@
+/**************************************************************
+ * @file unbounded_queue_impl.hpp
+ * @brief An unbounded queue implementation written in standard
+ * c++11 built from linked, recycled segments. Lock-free and
+ * wait-free for the consumer in single-producer single-
+ * consumer scenarios.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+
+#include <new>
+
+namespace lockfree {
+namespace spsc {
+/********************** PUBLIC METHODS ************************/
+
+template <typename T, size_t segment_size>
+UnboundedQueue<T, segment_size>::UnboundedQueue()
+    : _w_count(0U), _tail(&_first_segment), _w(0U), _first(&_first_segment),
+      _head_cache(&_first_segment), _r_count(0U), _head(&_first_segment),
+      _r(0U) {
+    _first_segment.next.store(nullptr, std::memory_order_relaxed);
+    _first_segment.embedded = true;
+}
+
+template <typename T, size_t segment_size>
+UnboundedQueue<T, segment_size>::~UnboundedQueue() {
+    /* Every segment is linked between the oldest one and the tail */
+    Segment *segment = _first;
+    while (segment != nullptr) {
+        Segment *next = segment->next.load(std::memory_order_relaxed);
+        if (!segment->embedded) {
+            delete segment;
+        }
+        segment = next;
+    }
+}
+
+template <typename T, size_t segment_size>
+bool UnboundedQueue<T, segment_size>::Push(const T &element) {
+    if (_w == segment_size) {
+        Segment *const segment = AcquireSegment();
+        if (segment == nullptr) {
+            return false;
+        }
+
+        /* Published to the consumer by the release store of _w_count */
+        _tail->next.store(segment, std::memory_order_relaxed);
+        _tail = segment;
+        _w = 0U;
+    }
+
+    /* Place the element */
+    _tail->data[_w] = element;
+    _w++;
+
+    /* Store the write count */
+    _w_count.store(_w_count.load(std::memory_order_relaxed) + 1U,
+                   std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t segment_size>
+bool UnboundedQueue<T, segment_size>::Pop(T &element) {
+    /* Preload counts with adequate memory ordering */
+    const size_t r_count = _r_count.load(std::memory_order_relaxed);
+    const size_t w_count = _w_count.load(std::memory_order_acquire);
+
+    /* Empty check */
+    if (r_count == w_count) {
+        return false;
+    }
+
+    Segment *segment = _head.load(std::memory_order_relaxed);
+    if (_r == segment_size) {
+        /*
+         * The producer linked the next segment before pushing into it. Once
+         * the head moves on, the drained segment can be reused by the
+         * producer, so the release store orders all reads from it before.
+         */
+        segment = segment->next.load(std::memory_order_relaxed);
+        _head.store(segment, std::memory_order_release);
+        _r = 0U;
+    }
+
+    /* Remove the element */
+    element = segment->data[_r];
+    _r++;
+
+    /* Store the read count */
+    _r_count.store(r_count + 1U, std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t segment_size>
+size_t UnboundedQueue<T, segment_size>::SizeApprox() const {
+    const size_t r_count = _r_count.load(std::memory_order_relaxed);
+    const size_t w_count = _w_count.load(std::memory_order_relaxed);
+
+    /*
+       From a thread other than the producer or the consumer, the relaxed
+       loads can see the read count ahead of the write count, so the wrapped
+       difference is taken as signed and reported as empty when negative.
+     */
+    const std::ptrdiff_t count = static_cast<std::ptrdiff_t>(w_count - r_count);
+    return count > 0 ? static_cast<size_t>(count) : 0U;
+}
+
+template <typename T, size_t segment_size>
+bool UnboundedQueue<T, segment_size>::EmptyApprox() const {
+    return SizeApprox() == 0U;
+}
+
+/********************* std::optional API **********************/
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+template <typename T, size_t segment_size>
+std::optional<T> UnboundedQueue<T, segment_size>::Pop() {
+    T element;
+    bool result = Pop(element);
+
+    if (result) {
+        return element;
+    } else {
+        return {};
+    }
+}
+#endif
+
+/********************* PRIVATE METHODS ************************/
+
+template <typename T, size_t segment_size>
+typename UnboundedQueue<T, segment_size>::Segment *
+UnboundedQueue<T, segment_size>::AcquireSegment() {
+    /*
+     * Segments before the head of the consumer have been drained. The head
+     * is only reloaded once the cached free chain runs out, so the producer
+     * rarely touches the cacheline of the consumer.
+     */
+    if (_first == _head_cache) {
+        _head_cache = _head.load(std::memory_order_acquire);
+    }
+
+    Segment *segment;
+    if (_first != _head_cache) {
+        segment = _first;
+        _first = segment->next.load(std::memory_order_relaxed);
+    } else {
+        segment = new (std::nothrow) Segment;
+        if (segment == nullptr) {
+            return nullptr;
+        }
+        segment->embedded = false;
+    }
+
+    segment->next.store(nullptr, std::memory_order_relaxed);
+    return segment;
+}
+
+} /* namespace spsc */
+} /* namespace lockfree */
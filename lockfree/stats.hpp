@@ -0,0 +1,146 @@
+/**************************************************************
+ * @file stats.hpp
+ * @brief Statistics policies for counting events in the
+ * lock free data structures.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_STATS_HPP
+#define LOCKFREE_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace lockfree {
+/*************************** TYPES ****************************/
+
+/**
+ * A point in time copy of the counters of a data structure. Counters are
+ * read independently, so the snapshot is not atomic as a whole.
+ */
+struct StatsSnapshot {
+    size_t push_full;    /**< Pushes that failed on a full data structure */
+    size_t pop_empty;    /**< Pops that failed on an empty data structure */
+    size_t push_retries; /**< Push attempts lost to other producers */
+    size_t pop_retries;  /**< Pop attempts lost to other consumers */
+    size_t high_water;   /**< Highest element count seen after a push */
+};
+
+/**
+ * The default statistics policy, counting nothing and taking no space when
+ * used as a base class.
+ */
+class NoStats {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    static constexpr bool enabled = false;
+
+    void OnPushFull() {}
+    void OnPopEmpty() {}
+    void OnPushRetry() {}
+    void OnPopRetry() {}
+    void OnPushed(size_t count) { (void)count; }
+
+    /**
+     * @brief Returns all counters as zero.
+     * @retval Counter snapshot
+     */
+    StatsSnapshot GetSnapshot() const { return StatsSnapshot(); }
+};
+
+/**
+ * A statistics policy counting events with relaxed atomics. Producer and
+ * consumer counters live on separate cachelines so counting does not add
+ * contention between the two sides.
+ */
+class Stats {
+    /********************** PUBLIC METHODS ************************/
+  public:
+    static constexpr bool enabled = true;
+
+    Stats();
+
+    void OnPushFull();
+    void OnPopEmpty();
+    void OnPushRetry();
+    void OnPopRetry();
+
+    /**
+     * @brief Updates the high water mark.
+     * @param[in] count Element count right after a push
+     */
+    void OnPushed(size_t count);
+
+    /**
+     * @brief Reads all counters.
+     * Can be called from any thread.
+     * @retval Counter snapshot
+     */
+    StatsSnapshot GetSnapshot() const;
+
+    /*********************** PRIVATE TYPES ************************/
+  private:
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) ProducerCounters {
+#else
+    struct ProducerCounters {
+#endif
+        std::atomic_size_t push_full;
+        std::atomic_size_t push_retries;
+        std::atomic_size_t high_water;
+    };
+
+#if LOCKFREE_CACHE_COHERENT
+    struct alignas(LOCKFREE_CACHELINE_LENGTH) ConsumerCounters {
+#else
+    struct ConsumerCounters {
+#endif
+        std::atomic_size_t pop_empty;
+        std::atomic_size_t pop_retries;
+    };
+
+    /********************** PRIVATE MEMBERS ***********************/
+  private:
+    ProducerCounters _producer; /**< Counters written by producers */
+    ConsumerCounters _consumer; /**< Counters written by consumers */
+};
+
+} /* namespace lockfree */
+
+/************************** INCLUDE ***************************/
+
+/* Include the implementation */
+#include "stats_impl.hpp"
+
+#endif /* LOCKFREE_STATS_HPP */
@@ -0,0 +1,86 @@
+/**************************************************************
+ * @file stats_impl.hpp
+ * @brief Statistics policies for counting events in the
+ * lock free data structures.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+namespace lockfree {
+/********************** PUBLIC METHODS ************************/
+
+inline Stats::Stats() {
+    _producer.push_full.store(0U, std::memory_order_relaxed);
+    _producer.push_retries.store(0U, std::memory_order_relaxed);
+    _producer.high_water.store(0U, std::memory_order_relaxed);
+    _consumer.pop_empty.store(0U, std::memory_order_relaxed);
+    _consumer.pop_retries.store(0U, std::memory_order_relaxed);
+}
+
+inline void Stats::OnPushFull() {
+    _producer.push_full.fetch_add(1U, std::memory_order_relaxed);
+}
+
+inline void Stats::OnPopEmpty() {
+    _consumer.pop_empty.fetch_add(1U, std::memory_order_relaxed);
+}
+
+inline void Stats::OnPushRetry() {
+    _producer.push_retries.fetch_add(1U, std::memory_order_relaxed);
+}
+
+inline void Stats::OnPopRetry() {
+    _consumer.pop_retries.fetch_add(1U, std::memory_order_relaxed);
+}
+
+inline void Stats::OnPushed(const size_t count) {
+    /* Only write when the mark rises, which is rare once warmed up */
+    size_t high_water = _producer.high_water.load(std::memory_order_relaxed);
+    while (count > high_water &&
+           !_producer.high_water.compare_exchange_weak(
+               high_water, count, std::memory_order_relaxed)) {
+    }
+}
+
+inline StatsSnapshot Stats::GetSnapshot() const {
+    StatsSnapshot snapshot;
+    snapshot.push_full = _producer.push_full.load(std::memory_order_relaxed);
+    snapshot.push_retries =
+        _producer.push_retries.load(std::memory_order_relaxed);
+    snapshot.high_water = _producer.high_water.load(std::memory_order_relaxed);
+    snapshot.pop_empty = _consumer.pop_empty.load(std::memory_order_relaxed);
+    snapshot.pop_retries =
+        _consumer.pop_retries.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+} /* namespace lockfree */
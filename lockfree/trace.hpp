@@ -0,0 +1,131 @@
+/**************************************************************
+ * @file trace.hpp
+ * @brief Static tracepoints for the lock free data structures,
+ * compatible with perf and bpftrace.
+ **************************************************************/
+
+/**************************************************************
+ * Copyright (c) 2023-2026 Djordje Nedic
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to
+ * whom the Software is furnished to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall
+ * be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY
+ * KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of lockfree
+ *
+ * Author:          Djordje Nedic <nedic.djordje2@gmail.com>
+ * Version:         v3.0.0
+ **************************************************************/
+
+/************************** INCLUDE ***************************/
+#ifndef LOCKFREE_TRACE_HPP
+#define LOCKFREE_TRACE_HPP
+
+#include <cstddef>
+
+/*
+   Every probe passes the address of the data structure followed by two
+   values described in the tracing documentation, such as the indexes at the
+   time of the event.
+ */
+#define LOCKFREE_TRACE_PROBES(X)                                               \
+    X(spsc_queue_push)                                                         \
+    X(spsc_queue_push_full)                                                    \
+    X(spsc_queue_pop)                                                          \
+    X(spsc_queue_pop_empty)                                                    \
+    X(mpmc_queue_push)                                                         \
+    X(mpmc_queue_push_full)                                                    \
+    X(mpmc_queue_pop)                                                          \
+    X(mpmc_queue_pop_empty)                                                    \
+    X(ring_buf_write)                                                          \
+    X(ring_buf_write_full)                                                     \
+    X(ring_buf_read)                                                           \
+    X(ring_buf_read_empty)                                                     \
+    X(bipartite_buf_write_full)                                                \
+    X(bipartite_buf_wrap)                                                      \
+    X(bipartite_buf_write_release)                                             \
+    X(bipartite_buf_read_empty)                                                \
+    X(bipartite_buf_invalidate)                                                \
+    X(bipartite_buf_read_release)
+
+#if LOCKFREE_TRACING && defined(__GNUC__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define LOCKFREE_TRACING_USDT
+#else
+#define LOCKFREE_TRACING_FUNCTIONS
+#endif
+#endif
+
+#if defined(LOCKFREE_TRACING_USDT)
+/*
+   USDT probes with semaphores, a probe costs a single load and a not taken
+   branch until a tracer attaches and increments its semaphore. The
+   semaphores are weak so that every translation unit can define them.
+ */
+#ifndef _SDT_HAS_SEMAPHORES
+#define _SDT_HAS_SEMAPHORES 1
+#endif
+#include <sys/sdt.h>
+
+#define LOCKFREE_TRACE_SEMAPHORE(name)                                         \
+    __attribute__((weak, section(".probes"))) volatile unsigned short          \
+        lockfree_##name##_semaphore = 0;
+
+extern "C" {
+LOCKFREE_TRACE_PROBES(LOCKFREE_TRACE_SEMAPHORE)
+}
+
+#define LOCKFREE_TRACE(name, container, a, b)                                  \
+    do {                                                                       \
+        if (__builtin_expect(lockfree_##name##_semaphore != 0U, 0)) {          \
+            STAP_PROBE3(lockfree, name, static_cast<const void *>(container),  \
+                        static_cast<size_t>(a), static_cast<size_t>(b));       \
+        }                                                                      \
+    } while (0)
+
+#elif defined(LOCKFREE_TRACING_FUNCTIONS)
+/*
+   Without sys/sdt.h every probe is a call to an empty function which can be
+   traced with uprobes instead, such as uprobe:./app:lockfree_spsc_queue_push
+   in bpftrace. This costs a call per event whether traced or not.
+ */
+#define LOCKFREE_TRACE_FUNCTION(name)                                          \
+    __attribute__((weak, noinline)) void lockfree_##name(                      \
+        const void *container, size_t a, size_t b) {                           \
+        __asm__ volatile("" : : "r"(container), "r"(a), "r"(b));               \
+    }
+
+extern "C" {
+LOCKFREE_TRACE_PROBES(LOCKFREE_TRACE_FUNCTION)
+}
+
+#define LOCKFREE_TRACE(name, container, a, b)                                  \
+    lockfree_##name(static_cast<const void *>(container),                      \
+                    static_cast<size_t>(a), static_cast<size_t>(b))
+
+#else
+/* Tracing is disabled, probes compile to nothing */
+#define LOCKFREE_TRACE(name, container, a, b)                                  \
+    do {                                                                       \
+    } while (0)
+#endif
+
+#endif /* LOCKFREE_TRACE_HPP */
@@ -0,0 +1,209 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <coroutine>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "coro/async_queue.hpp"
+#include "lockfree.hpp"
+
+namespace {
+/* A coroutine that starts eagerly and frees itself when done */
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/* Defers resumption until the test runs the executor explicitly */
+struct DeferredExecutor {
+    std::vector<std::coroutine_handle<>> *pending;
+    void operator()(std::coroutine_handle<> handle) const {
+        pending->push_back(handle);
+    }
+};
+
+template <typename Queue>
+Detached PopInto(Queue &queue, uint32_t &out, bool &done) {
+    out = co_await queue.PopAsync();
+    done = true;
+}
+
+template <typename Queue>
+Detached PushFrom(Queue &queue, uint32_t value, bool &done) {
+    co_await queue.PushAsync(value);
+    done = true;
+}
+} // namespace
+
+TEST_CASE("coro::AsyncQueue - Pop from non-empty", "[coro_pop_ready]") {
+    lockfree::coro::AsyncQueue<lockfree::spsc::Queue<uint32_t, 8U>> queue;
+    uint32_t read = 0;
+    bool done = false;
+
+    REQUIRE(queue.Push(42U));
+    PopInto(queue, read, done);
+
+    REQUIRE(done);
+    REQUIRE(read == 42U);
+}
+
+TEST_CASE("coro::AsyncQueue - Pop from empty suspends",
+          "[coro_pop_suspend]") {
+    lockfree::coro::AsyncQueue<lockfree::spsc::Queue<uint32_t, 8U>> queue;
+    uint32_t read = 0;
+    bool done = false;
+
+    PopInto(queue, read, done);
+    REQUIRE(!done);
+
+    /* The push resumes the waiting coroutine */
+    REQUIRE(queue.Push(7U));
+    REQUIRE(done);
+    REQUIRE(read == 7U);
+
+    /* The element was handed to the coroutine */
+    uint32_t element = 0;
+    REQUIRE(!queue.Pop(element));
+}
+
+TEST_CASE("coro::AsyncQueue - Push to full suspends", "[coro_push_suspend]") {
+    lockfree::coro::AsyncQueue<lockfree::mpmc::Queue<uint32_t, 4U>> queue;
+    bool done = false;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        REQUIRE(queue.Push(i));
+    }
+    REQUIRE(!queue.Push(4U));
+
+    PushFrom(queue, 4U, done);
+    REQUIRE(!done);
+
+    /* The pop frees a slot and resumes the waiting coroutine */
+    uint32_t element = 0;
+    REQUIRE(queue.Pop(element));
+    REQUIRE(element == 0U);
+    REQUIRE(done);
+
+    for (uint32_t i = 1; i < 5U; i++) {
+        REQUIRE(queue.Pop(element));
+        REQUIRE(element == i);
+    }
+    REQUIRE(!queue.Pop(element));
+}
+
+TEST_CASE("coro::AsyncQueue - Multiple waiters", "[coro_multiple_waiters]") {
+    lockfree::coro::AsyncQueue<lockfree::mpmc::Queue<uint32_t, 8U>> queue;
+    uint32_t read[3] = {0};
+    bool done[3] = {false};
+
+    for (size_t i = 0; i < 3U; i++) {
+        PopInto(queue, read[i], done[i]);
+    }
+
+    REQUIRE(queue.Push(10U));
+    REQUIRE(queue.Push(11U));
+    REQUIRE((done[0] + done[1] + done[2]) == 2);
+
+    REQUIRE(queue.Push(12U));
+    REQUIRE((done[0] && done[1] && done[2]));
+    REQUIRE(read[0] + read[1] + read[2] == 33U);
+}
+
+TEST_CASE("coro::AsyncQueue - Custom executor", "[coro_executor]") {
+    std::vector<std::coroutine_handle<>> pending;
+    lockfree::coro::AsyncQueue<lockfree::spsc::Queue<uint32_t, 8U>,
+                               DeferredExecutor>
+        queue(DeferredExecutor{&pending});
+    uint32_t read = 0;
+    bool done = false;
+
+    PopInto(queue, read, done);
+    REQUIRE(queue.Push(3U));
+
+    /* Resumption is left to the executor */
+    REQUIRE(!done);
+    REQUIRE(pending.size() == 1U);
+
+    pending.front().resume();
+    REQUIRE(done);
+    REQUIRE(read == 3U);
+}
+
+namespace {
+template <typename Queue>
+Detached Produce(Queue &queue, uint64_t first, uint64_t count,
+                 std::atomic_size_t &finished) {
+    for (uint64_t i = first; i < first + count; i++) {
+        co_await queue.PushAsync(i);
+    }
+    finished.fetch_add(1U);
+}
+
+template <typename Queue>
+Detached Consume(Queue &queue, uint64_t count, std::atomic<uint64_t> &sum,
+                 std::atomic_size_t &finished) {
+    for (uint64_t i = 0; i < count; i++) {
+        sum.fetch_add(co_await queue.PopAsync());
+    }
+    finished.fetch_add(1U);
+}
+} // namespace
+
+TEST_CASE("coro::AsyncQueue - Multithreaded spsc read/write",
+          "[coro_spsc_multithread]") {
+    lockfree::coro::AsyncQueue<lockfree::spsc::Queue<uint64_t, 16U>> queue;
+    std::atomic<uint64_t> sum(0U);
+    std::atomic_size_t finished(0U);
+    std::vector<std::thread> threads;
+
+    threads.emplace_back(
+        [&]() { Consume(queue, TEST_MT_TRANSFER_CNT, sum, finished); });
+    threads.emplace_back(
+        [&]() { Produce(queue, 0U, TEST_MT_TRANSFER_CNT, finished); });
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    /* Suspended coroutines finish on the thread that resumes them */
+    while (finished.load() != 2U) {
+    }
+
+    const uint64_t n = TEST_MT_TRANSFER_CNT;
+    REQUIRE(sum.load() == n * (n - 1U) / 2U);
+}
+
+TEST_CASE("coro::AsyncQueue - Multithreaded mpmc read/write",
+          "[coro_mpmc_multithread]") {
+    lockfree::coro::AsyncQueue<lockfree::mpmc::Queue<uint64_t, 16U>> queue;
+    std::atomic<uint64_t> sum(0U);
+    std::atomic_size_t finished(0U);
+    std::vector<std::thread> threads;
+    const uint64_t per_thread = TEST_MT_TRANSFER_CNT / 2U;
+
+    for (uint64_t i = 0; i < 2U; i++) {
+        threads.emplace_back(
+            [&]() { Consume(queue, per_thread, sum, finished); });
+    }
+    for (uint64_t i = 0; i < 2U; i++) {
+        threads.emplace_back([&, i]() {
+            Produce(queue, i * per_thread, per_thread, finished);
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    while (finished.load() != 4U) {
+    }
+
+    const uint64_t n = 2U * per_thread;
+    REQUIRE(sum.load() == n * (n - 1U) / 2U);
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "event/notifier.hpp"
+#include "lockfree.hpp"
+
+namespace {
+bool IsSignaled(const lockfree::event::Notifier &notifier, int timeout_ms) {
+    pollfd pfd = {notifier.GetFd(), POLLIN, 0};
+    return poll(&pfd, 1, timeout_ms) == 1;
+}
+} // namespace
+
+TEST_CASE("event::Notifier - Create", "[ev_create]") {
+    lockfree::event::Notifier notifier;
+
+    REQUIRE(notifier.IsValid());
+    REQUIRE(notifier.GetFd() >= 0);
+    REQUIRE(!IsSignaled(notifier, 0));
+}
+
+TEST_CASE("event::Notifier - Notify without arming", "[ev_notify_unarmed]") {
+    lockfree::event::Notifier notifier;
+
+    notifier.Notify();
+    REQUIRE(!IsSignaled(notifier, 0));
+}
+
+TEST_CASE("event::Notifier - Notify after arming", "[ev_notify_armed]") {
+    lockfree::event::Notifier notifier;
+
+    notifier.Arm();
+    notifier.Notify();
+    REQUIRE(IsSignaled(notifier, 0));
+
+    notifier.Clear();
+    REQUIRE(!IsSignaled(notifier, 0));
+}
+
+TEST_CASE("event::Notifier - Burst is coalesced", "[ev_coalesce]") {
+    lockfree::event::Notifier notifier;
+
+    notifier.Arm();
+    for (int i = 0; i < 100; i++) {
+        notifier.Notify();
+    }
+
+    /* Only a single signal was written to the eventfd */
+    uint64_t signals = 0;
+    REQUIRE(read(notifier.GetFd(), &signals, sizeof(signals)) ==
+            sizeof(signals));
+    REQUIRE(signals == 1U);
+
+    /* Disarmed until armed again */
+    notifier.Notify();
+    REQUIRE(!IsSignaled(notifier, 0));
+}
+
+TEST_CASE("event::Notifier - Multithreaded read/write", "[ev_multithread]") {
+    std::vector<std::thread> threads;
+    lockfree::spsc::Queue<uint64_t, 64U> queue;
+    lockfree::event::Notifier notifier;
+    std::vector<uint64_t> written;
+    std::vector<uint64_t> read;
+    size_t lost_wakeups = 0;
+
+    // consumer
+    threads.emplace_back([&]() {
+        uint64_t element = 0;
+        while (element < TEST_MT_TRANSFER_CNT) {
+            if (queue.Pop(element)) {
+                read.push_back(element);
+                continue;
+            }
+
+            /* Found empty, arm and check again before waiting */
+            notifier.Arm();
+            if (queue.Pop(element)) {
+                read.push_back(element);
+                continue;
+            }
+
+            /* A producer that pushed after arming must have signaled */
+            if (!IsSignaled(notifier, 1000)) {
+                lost_wakeups++;
+            }
+            notifier.Clear();
+        }
+    });
+
+    // producer
+    threads.emplace_back([&]() {
+        uint64_t element = 0;
+        do {
+            if (queue.Push(element)) {
+                notifier.Notify();
+                written.push_back(element);
+                element++;
+            }
+        } while (element < TEST_MT_TRANSFER_CNT + 1);
+    });
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    REQUIRE(lost_wakeups == 0U);
+    REQUIRE(written == read);
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "lockfree.hpp"
+#include "mem/storage.hpp"
+
+TEST_CASE("mem::Storage - Allocate with defaults", "[mem_allocate]") {
+    lockfree::mem::Storage<lockfree::spsc::RingBuf<uint8_t, 1U << 20>> storage;
+
+    REQUIRE(storage.Get() == nullptr);
+    REQUIRE(storage.Allocate());
+    REQUIRE(storage.Get() != nullptr);
+
+    const auto &report = storage.GetReport();
+    REQUIRE(report.mapped_size >= sizeof(*storage.Get()));
+    REQUIRE(report.prefaulted);
+
+    /* Huge pages can only back the mapping if it is aligned to them */
+    constexpr size_t huge_page_size = 2U * 1024U * 1024U;
+    REQUIRE(reinterpret_cast<uintptr_t>(storage.Get()) % huge_page_size == 0U);
+    REQUIRE(report.mapped_size % huge_page_size == 0U);
+    REQUIRE(report.numa_node == lockfree::mem::numa_node_none);
+
+    /* The container is constructed and usable */
+    REQUIRE(storage.Get()->GetAvailable() == 0U);
+    const uint8_t test_data[64] = {0xA5U};
+    REQUIRE(storage.Get()->Write(test_data, sizeof(test_data)));
+    REQUIRE(storage.Get()->GetAvailable() == sizeof(test_data));
+
+    /* Allocating twice is not allowed */
+    REQUIRE(!storage.Allocate());
+}
+
+TEST_CASE("mem::Storage - Allocate without huge pages",
+          "[mem_allocate_no_huge]") {
+    lockfree::mem::Storage<lockfree::mpmc::Queue<uint64_t, 4096U>> storage;
+    lockfree::mem::StorageConfig config;
+    config.huge_pages = false;
+    config.prefault = false;
+
+    REQUIRE(storage.Allocate(config));
+
+    const auto &report = storage.GetReport();
+    REQUIRE(!report.explicit_huge_pages);
+    REQUIRE(!report.transparent_huge_pages);
+    REQUIRE(!report.prefaulted);
+    REQUIRE(report.mapped_size % static_cast<size_t>(sysconf(_SC_PAGESIZE)) ==
+            0U);
+
+    REQUIRE(storage.Get()->Push(42U));
+    REQUIRE(storage.Get()->Pop() == 42U);
+}
+
+TEST_CASE("mem::Storage - Bind to the local NUMA node", "[mem_numa_local]") {
+    lockfree::mem::Storage<lockfree::spsc::Queue<uint32_t, 1024U>> storage;
+    lockfree::mem::StorageConfig config;
+    config.numa_node = lockfree::mem::numa_node_local;
+
+    REQUIRE(storage.Allocate(config));
+
+    /* Binding is best effort, kernels without NUMA support refuse it */
+    REQUIRE(storage.GetReport().numa_node >= lockfree::mem::numa_node_none);
+    REQUIRE(storage.Get()->Push(1U));
+}
+
+TEST_CASE("mem::Storage - Bind to a nonexistent NUMA node",
+          "[mem_numa_invalid]") {
+    lockfree::mem::Storage<lockfree::spsc::Queue<uint32_t, 1024U>> storage;
+    lockfree::mem::StorageConfig config;
+    config.numa_node = 4000;
+
+    REQUIRE(storage.Allocate(config));
+    REQUIRE(storage.GetReport().numa_node == lockfree::mem::numa_node_none);
+}
+
+TEST_CASE("mem::Storage - Free", "[mem_free]") {
+    lockfree::mem::Storage<lockfree::spsc::Queue<uint32_t, 1024U>> storage;
+
+    REQUIRE(storage.Allocate());
+    storage.Free();
+    REQUIRE(storage.Get() == nullptr);
+    REQUIRE(storage.GetReport().mapped_size == 0U);
+
+    /* Can be allocated again after freeing */
+    REQUIRE(storage.Allocate());
+}
+
+TEST_CASE("mem::Storage - Multithreaded read/write", "[mem_multithread]") {
+    std::vector<std::thread> threads;
+    lockfree::mem::Storage<lockfree::spsc::Queue<uint64_t, 1U << 16>> storage;
+    REQUIRE(storage.Allocate());
+    auto &queue = *storage.Get();
+    std::vector<uint64_t> written;
+    std::vector<uint64_t> read;
+
+    // consumer
+    threads.emplace_back([&]() {
+        uint64_t element = 0;
+        do {
+            if (queue.Pop(element)) {
+                read.push_back(element);
+            }
+        } while (element < TEST_MT_TRANSFER_CNT);
+    });
+
+    // producer
+    threads.emplace_back([&]() {
+        uint64_t element = 0;
+        do {
+            if (queue.Push(element)) {
+                written.push_back(element);
+                element++;
+            }
+        } while (element < TEST_MT_TRANSFER_CNT + 1);
+    });
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    REQUIRE(written == read);
+}
@@ -0,0 +1,241 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+TEST_CASE("mpmc::DelayQueue - Not available before the deadline",
+          "[mpmc_dq_deadline]") {
+    lockfree::mpmc::DelayQueue<int16_t, 32, 16> queue;
+
+    bool const push_success = queue.Push(-1024, 10U);
+    REQUIRE(push_success);
+
+    int16_t read = 0;
+    REQUIRE(!queue.Pop(read, 9U));
+    REQUIRE(read == 0);
+
+    bool const pop_success = queue.Pop(read, 10U);
+    REQUIRE(pop_success);
+    REQUIRE(read == -1024);
+    REQUIRE(!queue.Pop(read, 100U));
+}
+
+TEST_CASE("mpmc::DelayQueue - Earlier deadlines are read first",
+          "[mpmc_dq_order]") {
+    lockfree::mpmc::DelayQueue<uint64_t, 16, 8> queue;
+
+    REQUIRE(queue.Push(512U, 7U));
+    REQUIRE(queue.Push(128U, 2U));
+    REQUIRE(queue.Push(256U, 5U));
+    REQUIRE(queue.Push(1024U, 2U));
+
+    uint64_t read = 0;
+    REQUIRE(queue.Pop(read, 7U));
+    REQUIRE(read == 128U);
+    REQUIRE(queue.Pop(read, 7U));
+    REQUIRE(read == 1024U);
+    REQUIRE(queue.Pop(read, 7U));
+    REQUIRE(read == 256U);
+    REQUIRE(queue.Pop(read, 7U));
+    REQUIRE(read == 512U);
+    REQUIRE(!queue.Pop(read, 7U));
+}
+
+TEST_CASE("mpmc::DelayQueue - Deadlines are rounded up to the resolution",
+          "[mpmc_dq_resolution]") {
+    lockfree::mpmc::DelayQueue<uint32_t, 16, 8, 100> queue;
+
+    REQUIRE(queue.Push(1U, 120U));
+    REQUIRE(queue.Push(2U, 200U));
+
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read, 150U));
+    REQUIRE(!queue.Pop(read, 199U));
+
+    /* Both deadlines fall into the same tick, so they keep their order */
+    REQUIRE(queue.Pop(read, 200U));
+    REQUIRE(read == 1U);
+    REQUIRE(queue.Pop(read, 200U));
+    REQUIRE(read == 2U);
+}
+
+TEST_CASE("mpmc::DelayQueue - Deadlines past the window are rejected",
+          "[mpmc_dq_horizon]") {
+    lockfree::mpmc::DelayQueue<uint32_t, 16, 8> queue;
+
+    REQUIRE(queue.Push(1U, 8U));
+    REQUIRE(!queue.Push(2U, 9U));
+
+    /* The window moves along with the time passed to Pop() */
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read, 4U));
+    REQUIRE(queue.Push(2U, 12U));
+    REQUIRE(!queue.Push(3U, 13U));
+
+    REQUIRE(queue.Pop(read, 12U));
+    REQUIRE(read == 1U);
+    REQUIRE(queue.Pop(read, 12U));
+    REQUIRE(read == 2U);
+}
+
+TEST_CASE("mpmc::DelayQueue - Past deadlines and large timestamps",
+          "[mpmc_dq_past]") {
+    const uint64_t start = 1700000000000000000ULL;
+    lockfree::mpmc::DelayQueue<uint64_t, 16, 8, 1000> queue(start - 500U);
+
+    uint64_t read = 0;
+    REQUIRE(!queue.Pop(read, start));
+
+    REQUIRE(queue.Push(1U, start - 5000U));
+    REQUIRE(queue.Push(2U, start + 3000U));
+    REQUIRE(queue.Push(3U, start + 8000U));
+    REQUIRE(!queue.Push(4U, start + 9000U));
+
+    REQUIRE(queue.Pop(read, start));
+    REQUIRE(read == 1U);
+    REQUIRE(!queue.Pop(read, start + 2999U));
+
+    /* Long after the window, everything left is available */
+    REQUIRE(queue.Pop(read, start + 1000000U));
+    REQUIRE(read == 2U);
+    REQUIRE(queue.Pop(read, start + 1000000U));
+    REQUIRE(read == 3U);
+    REQUIRE(queue.EmptyApprox());
+
+    REQUIRE(queue.Push(5U, start + 1003000U));
+    REQUIRE(!queue.Pop(read, start + 1002000U));
+    REQUIRE(queue.Pop(read, start + 1003000U));
+    REQUIRE(read == 5U);
+}
+
+TEST_CASE("mpmc::DelayQueue - Late pushes come after earlier deadlines",
+          "[mpmc_dq_late]") {
+    lockfree::mpmc::DelayQueue<uint32_t, 16, 8> queue;
+
+    REQUIRE(queue.Push(1U, 2U));
+    REQUIRE(queue.Push(2U, 3U));
+
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read, 1U));
+    REQUIRE(queue.Push(3U, 1U));
+
+    REQUIRE(queue.Pop(read, 3U));
+    REQUIRE(read == 1U);
+    REQUIRE(queue.Pop(read, 3U));
+    REQUIRE(read == 2U);
+    REQUIRE(queue.Pop(read, 3U));
+    REQUIRE(read == 3U);
+
+    /* A consumer behind the latest time does not get late pushes early */
+    REQUIRE(queue.Push(4U, 3U));
+    REQUIRE(!queue.Pop(read, 2U));
+    REQUIRE(queue.Pop(read, 3U));
+    REQUIRE(read == 4U);
+}
+
+TEST_CASE("mpmc::DelayQueue - Earlier ticks first after falling behind",
+          "[mpmc_dq_behind]") {
+    lockfree::mpmc::DelayQueue<uint32_t, 16, 8> queue;
+
+    REQUIRE(queue.Push(1U, 2U));
+    REQUIRE(queue.Push(2U, 8U));
+
+    /* Both ticks are more than bucket_count ticks old by now */
+    uint32_t read = 0;
+    REQUIRE(queue.Pop(read, 20U));
+    REQUIRE(read == 1U);
+    REQUIRE(queue.Pop(read, 20U));
+    REQUIRE(read == 2U);
+    REQUIRE(!queue.Pop(read, 20U));
+}
+
+TEST_CASE("mpmc::DelayQueue - Optional API", "[mpmc_dq_optional_api]") {
+    lockfree::mpmc::DelayQueue<int16_t, 32, 4> queue;
+
+    REQUIRE(queue.Push(-1024, 3U));
+    REQUIRE(!queue.Pop(2U));
+    REQUIRE(queue.Pop(3U) == -1024);
+}
+
+TEST_CASE("mpmc::DelayQueue - Size estimation", "[mpmc_dq_size_approx]") {
+    lockfree::mpmc::DelayQueue<uint32_t, 4, 4> queue;
+    REQUIRE(queue.SizeApprox() == 0U);
+    REQUIRE(queue.EmptyApprox());
+
+    /* Every bucket holds up to size elements */
+    while (queue.Push(1U, 1U)) {
+    }
+    REQUIRE(queue.Push(2U, 2U));
+    REQUIRE(queue.SizeApprox() == 5U);
+
+    uint32_t read = 0;
+    REQUIRE(queue.Pop(read, 1U));
+    REQUIRE(queue.SizeApprox() == 4U);
+
+    while (queue.Pop(read, 2U)) {
+    }
+    REQUIRE(queue.EmptyApprox());
+}
+
+TEST_CASE("mpmc::DelayQueue - Multithreaded push and pop",
+          "[mpmc_dq_multithread]") {
+    lockfree::mpmc::DelayQueue<uint64_t, 1024, 64> queue;
+    constexpr size_t producers = 2U;
+    constexpr size_t consumers = 2U;
+    constexpr uint64_t total = producers * TEST_MT_TRANSFER_CNT;
+
+    std::atomic<uint64_t> clock(0U);
+    std::atomic<uint64_t> received(0U);
+    std::vector<uint8_t> on_time(consumers, false);
+    std::vector<uint64_t> sums(consumers, 0U);
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, &clock]() {
+            for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                /* The deadline travels in the upper bits of the element */
+                const uint64_t deadline =
+                    clock.load(std::memory_order_relaxed) + 1U + i % 32U;
+                while (!queue.Push((deadline << 20U) | i, deadline)) {
+                }
+            }
+        });
+    }
+
+    for (size_t c = 0; c < consumers; c++) {
+        threads.emplace_back([&queue, &clock, &received, &on_time, &sums,
+                              c]() {
+            bool ok = true;
+            uint64_t sum = 0U;
+            while (received.load(std::memory_order_relaxed) < total) {
+                const uint64_t now =
+                    clock.fetch_add(1U, std::memory_order_relaxed) + 1U;
+                uint64_t read = 0;
+                if (queue.Pop(read, now)) {
+                    /* Never before the deadline, as of the time passed */
+                    ok = ok && (read >> 20U) <= now;
+                    sum += read & 0xFFFFFU;
+                    received.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+            on_time[c] = ok;
+            sums[c] = sum;
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    uint64_t sum = 0U;
+    for (size_t c = 0; c < consumers; c++) {
+        REQUIRE(on_time[c]);
+        sum += sums[c];
+    }
+    REQUIRE(received.load() == total);
+    REQUIRE(sum == producers * (TEST_MT_TRANSFER_CNT *
+                                (TEST_MT_TRANSFER_CNT - 1U) / 2U));
+}
@@ -0,0 +1,201 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+namespace {
+struct Order {
+    uint32_t slot;
+    uint16_t venue;
+    uint64_t quantity;
+};
+} // namespace
+
+TEST_CASE("mpmc::HashMap - Insert and find", "[mpmc_hm_insert_find]") {
+    lockfree::mpmc::HashMap<uint64_t, Order, 16> map;
+
+    const Order order = {7U, 3U, 1024U};
+    REQUIRE(map.Insert(123456789U, order));
+
+    Order found = {};
+    REQUIRE(map.Find(123456789U, found));
+    REQUIRE(found.slot == 7U);
+    REQUIRE(found.venue == 3U);
+    REQUIRE(found.quantity == 1024U);
+
+    REQUIRE(!map.Find(987654321U, found));
+}
+
+TEST_CASE("mpmc::HashMap - Insert existing key", "[mpmc_hm_insert_existing]") {
+    lockfree::mpmc::HashMap<int32_t, int32_t, 16> map;
+
+    REQUIRE(map.Insert(-5, 1));
+    REQUIRE(!map.Insert(-5, 2));
+
+    int32_t found = 0;
+    REQUIRE(map.Find(-5, found));
+    REQUIRE(found == 1);
+}
+
+TEST_CASE("mpmc::HashMap - Erase", "[mpmc_hm_erase]") {
+    lockfree::mpmc::HashMap<uint32_t, uint32_t, 16> map;
+
+    REQUIRE(!map.Erase(1U));
+    REQUIRE(map.Insert(1U, 10U));
+    REQUIRE(map.Insert(2U, 20U));
+
+    REQUIRE(map.Erase(1U));
+    REQUIRE(!map.Erase(1U));
+
+    uint32_t found = 0;
+    REQUIRE(!map.Find(1U, found));
+    REQUIRE(map.Find(2U, found));
+    REQUIRE(found == 20U);
+
+    /* An erased key can be inserted again */
+    REQUIRE(map.Insert(1U, 11U));
+    REQUIRE(map.Find(1U, found));
+    REQUIRE(found == 11U);
+}
+
+TEST_CASE("mpmc::HashMap - Full map", "[mpmc_hm_full]") {
+    lockfree::mpmc::HashMap<uint32_t, uint32_t, 8> map;
+
+    for (uint32_t i = 0; i < 8U; i++) {
+        REQUIRE(map.Insert(i, i * 10U));
+    }
+    REQUIRE(!map.Insert(8U, 80U));
+
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < 8U; i++) {
+        REQUIRE(map.Find(i, found));
+        REQUIRE(found == i * 10U);
+    }
+    REQUIRE(!map.Find(8U, found));
+
+    /* Erased slots are reused for other keys */
+    for (uint32_t round = 1; round < 4U; round++) {
+        for (uint32_t i = 0; i < 8U; i++) {
+            REQUIRE(map.Erase((round - 1U) * 8U + i));
+            REQUIRE(map.Insert(round * 8U + i, i));
+        }
+    }
+    for (uint32_t i = 0; i < 8U; i++) {
+        REQUIRE(map.Find(24U + i, found));
+        REQUIRE(found == i);
+    }
+}
+
+TEST_CASE("mpmc::HashMap - Churn through more keys than the capacity",
+          "[mpmc_hm_churn]") {
+    lockfree::mpmc::HashMap<uint64_t, uint64_t, 256> map;
+    constexpr uint64_t live = 32U;
+
+    /* Every slot ends up live or a tombstone, inserts have to reuse them */
+    uint64_t found = 0;
+    for (uint64_t key = 0; key < 16U * 256U; key++) {
+        REQUIRE(map.Insert(key, key * 3U));
+        if (key >= live) {
+            REQUIRE(map.Erase(key - live));
+            REQUIRE(!map.Find(key - live, found));
+        }
+    }
+
+    for (uint64_t key = 16U * 256U - live; key < 16U * 256U; key++) {
+        REQUIRE(map.Find(key, found));
+        REQUIRE(found == key * 3U);
+    }
+    REQUIRE(!map.Find(16U * 256U, found));
+    REQUIRE(!map.Erase(16U * 256U));
+}
+
+TEST_CASE("mpmc::HashMap - Optional API", "[mpmc_hm_optional_api]") {
+    lockfree::mpmc::HashMap<uint64_t, uint64_t, 16> map;
+
+    REQUIRE(!map.Find(42U));
+    map.Insert(42U, -1024);
+
+    REQUIRE(map.Find(42U) == -1024);
+}
+
+TEST_CASE("mpmc::HashMap - Concurrent inserts of the same key",
+          "[mpmc_hm_same_key]") {
+    lockfree::mpmc::HashMap<uint32_t, uint32_t, 64> map;
+    constexpr size_t threads = 4U;
+    constexpr uint32_t rounds = 1000U;
+    std::vector<uint32_t> wins(threads, 0U);
+    std::atomic_size_t arrived(0U);
+    uint32_t erased = 0U;
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&map, &wins, &arrived, &erased, t]() {
+            auto barrier = [&arrived](size_t target) {
+                arrived++;
+                while (arrived.load() < target) {
+                    std::this_thread::yield();
+                }
+            };
+            for (uint32_t round = 0; round < rounds; round++) {
+                barrier(threads * (2U * round + 1U));
+                if (map.Insert(round, static_cast<uint32_t>(t))) {
+                    wins[t]++;
+                }
+                barrier(threads * (2U * round + 2U));
+                /* Erased before anyone arrives at the next round */
+                if (t == 0U && map.Erase(round)) {
+                    erased++;
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    /* Exactly one insert of every round succeeds */
+    uint32_t total = 0U;
+    for (uint32_t w : wins) {
+        total += w;
+    }
+    REQUIRE(total == rounds);
+    REQUIRE(erased == rounds);
+}
+
+TEST_CASE("mpmc::HashMap - Multithreaded insert, find and erase",
+          "[mpmc_hm_multithread]") {
+    lockfree::mpmc::HashMap<uint64_t, uint64_t, 256> map;
+    constexpr size_t threads = 4U;
+    std::vector<uint8_t> consistent(threads, false);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&map, &consistent, t]() {
+            bool ok = true;
+            /* Every thread keeps up to 32 keys of its own in the map */
+            for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                const uint64_t key = t * TEST_MT_TRANSFER_CNT + i;
+                ok = ok && map.Insert(key, key * 3U);
+
+                uint64_t found = 0U;
+                ok = ok && map.Find(key, found) && found == key * 3U;
+
+                if (i >= 32U) {
+                    ok = ok && map.Erase(key - 32U);
+                    ok = ok && !map.Find(key - 32U, found);
+                }
+            }
+            consistent[t] = ok;
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t t = 0; t < threads; t++) {
+        REQUIRE(consistent[t]);
+    }
+}
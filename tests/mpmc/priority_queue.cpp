@@ -77,3 +77,27 @@ TEST_CASE("mpmc::PriorityQueue - Optional API", "[mpmc_pq_optional_api]") {
     auto const read = queue.Pop();
     REQUIRE(read == -1024);
 }
+
+TEST_CASE("mpmc::PriorityQueue - Size estimation", "[mpmc_pq_size_approx]") {
+    lockfree::mpmc::PriorityQueue<uint32_t, 4, 2> queue;
+    REQUIRE(queue.SizeApprox() == 0U);
+    REQUIRE(queue.EmptyApprox());
+
+    while (queue.Push(1U, 1)) {
+    }
+    REQUIRE(queue.FullApprox(1));
+    REQUIRE(!queue.FullApprox(0));
+
+    REQUIRE(queue.Push(0U, 0));
+    const size_t count = queue.SizeApprox();
+    REQUIRE(count >= 2U);
+
+    uint32_t read = 0;
+    REQUIRE(queue.Pop(read));
+    REQUIRE(queue.SizeApprox() == count - 1U);
+    REQUIRE(!queue.FullApprox(1));
+
+    while (queue.Pop(read)) {
+    }
+    REQUIRE(queue.EmptyApprox());
+}
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <math.h>
+#include <thread>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -89,3 +90,80 @@ TEST_CASE("mpmc::Queue - Optional API", "[mpmc_q_optional_api]") {
 
     REQUIRE(queue.Pop() == -1024);
 }
+
+TEST_CASE("mpmc::Queue - Stats", "[mpmc_q_stats]") {
+    lockfree::mpmc::Queue<uint32_t, 4, lockfree::Stats> queue;
+
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read));
+
+    REQUIRE(queue.Push(1U));
+    REQUIRE(queue.Push(2U));
+    REQUIRE(queue.Push(3U));
+    REQUIRE(queue.Push(4U));
+    REQUIRE(!queue.Push(5U));
+
+    REQUIRE(queue.Pop(read));
+    REQUIRE(queue.Push(6U));
+
+    const lockfree::StatsSnapshot stats = queue.GetStats();
+    REQUIRE(stats.push_full == 1U);
+    REQUIRE(stats.pop_empty == 1U);
+    REQUIRE(stats.high_water == 4U);
+}
+
+TEST_CASE("mpmc::Queue - Stats multithreaded", "[mpmc_q_stats_multithread]") {
+    lockfree::mpmc::Queue<uint32_t, 16, lockfree::Stats> queue;
+
+    auto producer = [&queue]() {
+        for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+            while (!queue.Push(i)) {
+            }
+        }
+    };
+    auto consumer = [&queue]() {
+        uint32_t read = 0;
+        for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+            while (!queue.Pop(read)) {
+            }
+        }
+    };
+
+    std::thread producers[] = {std::thread(producer), std::thread(producer)};
+    std::thread consumers[] = {std::thread(consumer), std::thread(consumer)};
+    for (auto &thread : producers) {
+        thread.join();
+    }
+    for (auto &thread : consumers) {
+        thread.join();
+    }
+
+    const lockfree::StatsSnapshot stats = queue.GetStats();
+    REQUIRE(stats.high_water >= 1U);
+    REQUIRE(stats.high_water <= 16U);
+}
+
+TEST_CASE("mpmc::Queue - Size estimation", "[mpmc_q_size_approx]") {
+    lockfree::mpmc::Queue<uint32_t, 4> queue;
+    REQUIRE(queue.SizeApprox() == 0U);
+    REQUIRE(queue.EmptyApprox());
+    REQUIRE(!queue.FullApprox());
+
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 10U; i++) {
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.SizeApprox() == 3U);
+        REQUIRE(!queue.EmptyApprox());
+
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.FullApprox());
+        REQUIRE(queue.SizeApprox() == 4U);
+
+        for (uint32_t j = 0; j < 4U; j++) {
+            REQUIRE(queue.Pop(read));
+        }
+        REQUIRE(queue.EmptyApprox());
+    }
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+TEST_CASE("mpmc::ShardedQueue - Write to empty and read back",
+          "[mpmc_sq_write_empty]") {
+    lockfree::mpmc::ShardedQueue<int16_t, 16, 4> queue;
+
+    bool const push_success = queue.Push(-1024);
+    REQUIRE(push_success);
+
+    int16_t read = 0;
+    bool const pop_success = queue.Pop(read);
+    REQUIRE(pop_success);
+    REQUIRE(read == -1024);
+}
+
+TEST_CASE("mpmc::ShardedQueue - Read empty", "[mpmc_sq_read_empty]") {
+    lockfree::mpmc::ShardedQueue<uint8_t, 16, 4> queue;
+
+    uint8_t read = 0;
+    bool const pop_success = queue.Pop(read);
+    REQUIRE(!pop_success);
+}
+
+TEST_CASE("mpmc::ShardedQueue - Overflow into other shards",
+          "[mpmc_sq_overflow]") {
+    lockfree::mpmc::ShardedQueue<uint32_t, 4, 3> queue;
+
+    /* All shards are used before a push fails */
+    for (uint32_t i = 0; i < 12U; i++) {
+        REQUIRE(queue.Push(i));
+    }
+    REQUIRE(!queue.Push(12U));
+    REQUIRE(queue.SizeApprox() == 12U);
+
+    std::vector<uint32_t> read;
+    uint32_t element = 0;
+    while (queue.Pop(element)) {
+        read.push_back(element);
+    }
+    std::sort(read.begin(), read.end());
+
+    REQUIRE(read.size() == 12U);
+    for (uint32_t i = 0; i < 12U; i++) {
+        REQUIRE(read[i] == i);
+    }
+    REQUIRE(queue.EmptyApprox());
+}
+
+TEST_CASE("mpmc::ShardedQueue - Explicit shards", "[mpmc_sq_explicit]") {
+    lockfree::mpmc::ShardedQueue<uint32_t, 4, 2> queue;
+
+    /* Pushing to a given shard does not overflow */
+    for (uint32_t i = 0; i < 4U; i++) {
+        REQUIRE(queue.Push(i, 1));
+    }
+    REQUIRE(!queue.Push(4U, 1));
+    REQUIRE(queue.Push(5U, 0));
+
+    /* Elements of a shard are popped in order */
+    uint32_t read = 0;
+    REQUIRE(queue.Pop(read, 1));
+    REQUIRE(read == 0U);
+    REQUIRE(queue.Pop(read, 1));
+    REQUIRE(read == 1U);
+
+    /* Popping sweeps into other shards */
+    REQUIRE(queue.Pop(read, 0));
+    REQUIRE(read == 5U);
+    REQUIRE(queue.Pop(read, 0));
+    REQUIRE(read == 2U);
+}
+
+TEST_CASE("mpmc::ShardedQueue - Optional API", "[mpmc_sq_optional_api]") {
+    lockfree::mpmc::ShardedQueue<uint64_t, 32, 2> queue;
+
+    REQUIRE(!queue.Pop());
+    queue.Push(-1024);
+
+    REQUIRE(queue.Pop() == -1024);
+}
+
+TEST_CASE("mpmc::ShardedQueue - Multiple producers and consumers",
+          "[mpmc_sq_multithread]") {
+    lockfree::mpmc::ShardedQueue<uint32_t, 64, 4> queue;
+    constexpr size_t threads = 4U;
+    std::vector<uint64_t> sums(threads, 0U);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&queue, t]() {
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                const uint32_t element = t * TEST_MT_TRANSFER_CNT + i;
+                while (!queue.Push(element)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        workers.emplace_back([&queue, &sums, t]() {
+            uint32_t read = 0;
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                while (!queue.Pop(read)) {
+                    std::this_thread::yield();
+                }
+                sums[t] += read;
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    uint64_t sum = 0U;
+    for (uint64_t s : sums) {
+        sum += s;
+    }
+    const uint64_t total = threads * TEST_MT_TRANSFER_CNT;
+    REQUIRE(sum == total * (total - 1U) / 2U);
+    REQUIRE(queue.EmptyApprox());
+}
@@ -0,0 +1,161 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+#include "mpmc/unbounded_queue.hpp"
+
+TEST_CASE("mpmc::UnboundedQueue - Write to empty and read back",
+          "[mpmc_uq_write_empty]") {
+    lockfree::mpmc::UnboundedQueue<int16_t, 8, 1> queue;
+    size_t thread = 0;
+    REQUIRE(queue.Register(thread));
+
+    int16_t read = 0;
+    REQUIRE(!queue.Pop(thread, read));
+
+    bool const push_success = queue.Push(thread, -1024);
+    REQUIRE(push_success);
+
+    bool const pop_success = queue.Pop(thread, read);
+    REQUIRE(pop_success);
+    REQUIRE(read == -1024);
+    REQUIRE(!queue.Pop(thread, read));
+}
+
+TEST_CASE("mpmc::UnboundedQueue - Grow past the segment size in order",
+          "[mpmc_uq_grow]") {
+    lockfree::mpmc::UnboundedQueue<uint32_t, 4, 1> queue;
+    size_t thread = 0;
+    REQUIRE(queue.Register(thread));
+
+    for (uint32_t i = 0; i < 100U; i++) {
+        REQUIRE(queue.Push(thread, i));
+    }
+
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 100U; i++) {
+        REQUIRE(queue.Pop(thread, read));
+        REQUIRE(read == i);
+    }
+    REQUIRE(!queue.Pop(thread, read));
+}
+
+TEST_CASE("mpmc::UnboundedQueue - Interleaved writes and reads reuse segments",
+          "[mpmc_uq_recycle]") {
+    lockfree::mpmc::UnboundedQueue<uint64_t, 4, 2> queue;
+    size_t producer = 0;
+    size_t consumer = 0;
+    REQUIRE(queue.Register(producer));
+    REQUIRE(queue.Register(consumer));
+
+    uint64_t written = 0;
+    uint64_t expected = 0;
+    for (size_t round = 0; round < 64U; round++) {
+        /* Alternate between bursts spanning several segments and draining */
+        const size_t burst = 1U + (round * 7U) % 13U;
+        for (size_t i = 0; i < burst; i++) {
+            REQUIRE(queue.Push(producer, written++));
+        }
+
+        uint64_t read = 0;
+        while (queue.Pop(consumer, read)) {
+            REQUIRE(read == expected);
+            expected++;
+        }
+        REQUIRE(expected == written);
+    }
+
+    queue.Unregister(producer);
+    queue.Unregister(consumer);
+}
+
+TEST_CASE("mpmc::UnboundedQueue - Optional API", "[mpmc_uq_optional_api]") {
+    lockfree::mpmc::UnboundedQueue<int16_t, 8, 1> queue;
+    size_t thread = 0;
+    REQUIRE(queue.Register(thread));
+
+    REQUIRE(!queue.Pop(thread));
+    REQUIRE(queue.Push(thread, -1024));
+    REQUIRE(queue.Pop(thread) == -1024);
+}
+
+TEST_CASE("mpmc::UnboundedQueue - Elements left in the queue are freed",
+          "[mpmc_uq_destructor]") {
+    lockfree::mpmc::UnboundedQueue<uint32_t, 4, 1> queue;
+    size_t thread = 0;
+    REQUIRE(queue.Register(thread));
+
+    for (uint32_t i = 0; i < 50U; i++) {
+        REQUIRE(queue.Push(thread, i));
+    }
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 25U; i++) {
+        REQUIRE(queue.Pop(thread, read));
+    }
+}
+
+TEST_CASE("mpmc::UnboundedQueue - Multithreaded write and read",
+          "[mpmc_uq_multithread]") {
+    lockfree::mpmc::UnboundedQueue<uint64_t, 64, 4> queue;
+    constexpr size_t producers = 2U;
+    constexpr size_t consumers = 2U;
+    constexpr uint64_t total = producers * TEST_MT_TRANSFER_CNT;
+
+    std::atomic<uint64_t> received(0U);
+    std::vector<uint8_t> ordered(consumers, false);
+    std::vector<uint64_t> sums(consumers, 0U);
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, p]() {
+            size_t thread = 0;
+            if (!queue.Register(thread)) {
+                return;
+            }
+            for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                /* The producer travels in the upper bits of the element */
+                queue.Push(thread, (uint64_t(p) << 32U) | i);
+            }
+            queue.Unregister(thread);
+        });
+    }
+
+    for (size_t c = 0; c < consumers; c++) {
+        threads.emplace_back([&queue, &received, &ordered, &sums, c]() {
+            size_t thread = 0;
+            bool ok = queue.Register(thread);
+            uint64_t sum = 0U;
+            std::vector<uint64_t> next(producers, 0U);
+            while (ok && received.load(std::memory_order_relaxed) < total) {
+                uint64_t read = 0;
+                if (queue.Pop(thread, read)) {
+                    /* Elements of a producer arrive in order */
+                    const size_t p = static_cast<size_t>(read >> 32U);
+                    const uint64_t i = read & 0xFFFFFFFFU;
+                    ok = ok && p < producers && i >= next[p];
+                    next[p] = i + 1U;
+                    sum += i;
+                    received.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+            queue.Unregister(thread);
+            ordered[c] = ok;
+            sums[c] = sum;
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    uint64_t sum = 0U;
+    for (size_t c = 0; c < consumers; c++) {
+        REQUIRE(ordered[c]);
+        sum += sums[c];
+    }
+    REQUIRE(received.load() == total);
+    REQUIRE(sum == producers * (TEST_MT_TRANSFER_CNT *
+                                (TEST_MT_TRANSFER_CNT - 1U) / 2U));
+}
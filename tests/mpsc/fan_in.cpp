@@ -0,0 +1,177 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+TEST_CASE("mpsc::FanIn - Write to empty and read back",
+          "[mpsc_fi_write_empty]") {
+    lockfree::mpsc::FanIn<int16_t, 16, 4> fan_in;
+
+    size_t producer = 0;
+    REQUIRE(fan_in.Register(producer));
+
+    bool const push_success = fan_in.Push(producer, -1024);
+    REQUIRE(push_success);
+
+    int16_t read = 0;
+    bool const pop_success = fan_in.Pop(read);
+    REQUIRE(pop_success);
+    REQUIRE(read == -1024);
+}
+
+TEST_CASE("mpsc::FanIn - Read empty", "[mpsc_fi_read_empty]") {
+    lockfree::mpsc::FanIn<uint8_t, 16, 4> fan_in;
+
+    uint8_t read = 0;
+    REQUIRE(!fan_in.Pop(read));
+
+    size_t producer = 0;
+    REQUIRE(fan_in.Register(producer));
+    REQUIRE(!fan_in.Pop(read));
+}
+
+TEST_CASE("mpsc::FanIn - Producer queue full", "[mpsc_fi_full]") {
+    lockfree::mpsc::FanIn<uint32_t, 4, 2> fan_in;
+
+    size_t first = 0;
+    size_t second = 0;
+    REQUIRE(fan_in.Register(first));
+    REQUIRE(fan_in.Register(second));
+    REQUIRE(first != second);
+
+    /* One slot of each spsc::Queue is always left empty */
+    for (uint32_t i = 0; i < 3U; i++) {
+        REQUIRE(fan_in.Push(first, i));
+    }
+    REQUIRE(!fan_in.Push(first, 3U));
+
+    /* Other producers are not affected */
+    REQUIRE(fan_in.Push(second, 3U));
+}
+
+TEST_CASE("mpsc::FanIn - Registration", "[mpsc_fi_registration]") {
+    lockfree::mpsc::FanIn<uint32_t, 8, 3> fan_in;
+
+    size_t producers[3] = {};
+    for (size_t i = 0; i < 3U; i++) {
+        REQUIRE(fan_in.Register(producers[i]));
+    }
+    size_t extra = 0;
+    REQUIRE(!fan_in.Register(extra));
+
+    /* A slot is only reusable once its elements have been consumed */
+    REQUIRE(fan_in.Push(producers[1], 7U));
+    fan_in.Unregister(producers[1]);
+    REQUIRE(!fan_in.Register(extra));
+
+    uint32_t read = 0;
+    REQUIRE(fan_in.Pop(read));
+    REQUIRE(read == 7U);
+    REQUIRE(!fan_in.Pop(read));
+
+    REQUIRE(fan_in.Register(extra));
+    REQUIRE(extra == producers[1]);
+}
+
+TEST_CASE("mpsc::FanIn - Fair batches", "[mpsc_fi_fair_batch]") {
+    lockfree::mpsc::FanIn<uint32_t, 32, 3> fan_in;
+
+    size_t producers[3] = {};
+    for (size_t i = 0; i < 3U; i++) {
+        REQUIRE(fan_in.Register(producers[i]));
+    }
+
+    /* A busy producer does not starve the others */
+    for (uint32_t i = 0; i < 16U; i++) {
+        REQUIRE(fan_in.Push(producers[0], i));
+    }
+    REQUIRE(fan_in.Push(producers[1], 100U));
+    REQUIRE(fan_in.Push(producers[2], 200U));
+
+    uint32_t read[8] = {};
+    REQUIRE(fan_in.PopBatch(read, 8U, 2U) == 4U);
+    REQUIRE(read[0] == 0U);
+    REQUIRE(read[1] == 1U);
+    REQUIRE(read[2] == 100U);
+    REQUIRE(read[3] == 200U);
+
+    /* Only the busy producer is left */
+    REQUIRE(fan_in.PopBatch(read, 8U, 4U) == 4U);
+    REQUIRE(read[0] == 2U);
+    REQUIRE(read[3] == 5U);
+
+    size_t total = 4U;
+    size_t popped = 0;
+    while ((popped = fan_in.PopBatch(read, 8U, 8U)) > 0U) {
+        total += popped;
+    }
+    REQUIRE(total == 14U);
+}
+
+TEST_CASE("mpsc::FanIn - Optional API", "[mpsc_fi_optional_api]") {
+    lockfree::mpsc::FanIn<uint64_t, 32, 2> fan_in;
+
+    size_t producer = 0;
+    REQUIRE(fan_in.Register(producer));
+
+    REQUIRE(!fan_in.Pop());
+    fan_in.Push(producer, -1024);
+
+    REQUIRE(fan_in.Pop() == -1024);
+}
+
+TEST_CASE("mpsc::FanIn - Multiple producers", "[mpsc_fi_multithread]") {
+    constexpr size_t threads = 4U;
+    lockfree::mpsc::FanIn<uint32_t, 64, threads> fan_in;
+    std::vector<std::thread> producers;
+
+    for (size_t t = 0; t < threads; t++) {
+        producers.emplace_back([&fan_in, t]() {
+            size_t producer = 0;
+            while (!fan_in.Register(producer)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                const uint32_t element = t * TEST_MT_TRANSFER_CNT + i;
+                while (!fan_in.Push(producer, element)) {
+                    std::this_thread::yield();
+                }
+            }
+            fan_in.Unregister(producer);
+        });
+    }
+
+    /* Elements of each producer arrive in the order they were pushed */
+    std::vector<uint32_t> next(threads, 0U);
+    uint64_t sum = 0U;
+    const uint64_t total = threads * TEST_MT_TRANSFER_CNT;
+    uint32_t read[16] = {};
+    for (uint64_t received = 0U; received < total;) {
+        const size_t popped = fan_in.PopBatch(read, 16U, 4U);
+        if (popped == 0U) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < popped; i++) {
+            const size_t t = read[i] / TEST_MT_TRANSFER_CNT;
+            REQUIRE(read[i] % TEST_MT_TRANSFER_CNT == next[t]);
+            next[t]++;
+            sum += read[i];
+        }
+        received += popped;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(sum == total * (total - 1U) / 2U);
+
+    /* Every slot is drained and can be claimed again */
+    uint32_t element = 0;
+    REQUIRE(!fan_in.Pop(element));
+    size_t producer = 0;
+    for (size_t t = 0; t < threads; t++) {
+        REQUIRE(fan_in.Register(producer));
+    }
+}
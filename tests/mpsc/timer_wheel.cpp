@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+namespace {
+using Wheel = lockfree::mpsc::TimerWheel<uint32_t, 64, 64, 16>;
+
+std::vector<uint32_t> ReadExpired(Wheel &wheel) {
+    std::vector<uint32_t> expired;
+    Wheel::Expiration expiration;
+    while (wheel.GetExpired().Read(&expiration, 1)) {
+        expired.push_back(expiration.data);
+    }
+    return expired;
+}
+} // namespace
+
+TEST_CASE("mpsc::TimerWheel - Expire at the deadline", "[tw_expire]") {
+    Wheel wheel;
+
+    uint64_t handle = 0;
+    REQUIRE(wheel.Schedule(10U, 1U, handle));
+
+    REQUIRE(wheel.Advance(9U) == 0U);
+    REQUIRE(ReadExpired(wheel).empty());
+
+    REQUIRE(wheel.Advance(10U) == 1U);
+    Wheel::Expiration expiration;
+    REQUIRE(wheel.GetExpired().Read(&expiration, 1));
+    REQUIRE(expiration.handle == handle);
+    REQUIRE(expiration.data == 1U);
+}
+
+TEST_CASE("mpsc::TimerWheel - Past deadlines", "[tw_past]") {
+    Wheel wheel;
+    wheel.Advance(100U);
+
+    uint64_t handle = 0;
+    REQUIRE(wheel.Schedule(50U, 2U, handle));
+    REQUIRE(wheel.Advance(100U) == 1U);
+    REQUIRE(ReadExpired(wheel) == std::vector<uint32_t>{2U});
+}
+
+TEST_CASE("mpsc::TimerWheel - Expire in deadline order", "[tw_order]") {
+    lockfree::mpsc::TimerWheel<uint32_t, 64, 64, 64> wheel;
+
+    /* Deadlines across all levels of the wheel, and past them */
+    const uint64_t deadlines[] = {1U,     63U,      64U,       65U,
+                                  4095U,  4096U,    5000U,     262143U,
+                                  262144U, 300000U, 16777215U, 16777216U,
+                                  20000000U};
+    const size_t cnt = sizeof(deadlines) / sizeof(deadlines[0]);
+    uint64_t handle = 0;
+    for (size_t i = cnt; i > 0U; i--) {
+        REQUIRE(wheel.Schedule(deadlines[i - 1U], i - 1U, handle));
+    }
+
+    for (size_t i = 0; i < cnt; i++) {
+        /* Nothing expires a tick early */
+        REQUIRE(wheel.Advance(deadlines[i] - 1U) == 0U);
+        REQUIRE(wheel.Advance(deadlines[i]) == 1U);
+
+        lockfree::mpsc::TimerWheel<uint32_t, 64, 64, 64>::Expiration expired;
+        REQUIRE(wheel.GetExpired().Read(&expired, 1));
+        REQUIRE(expired.data == i);
+    }
+}
+
+TEST_CASE("mpsc::TimerWheel - Cancel", "[tw_cancel]") {
+    Wheel wheel;
+
+    uint64_t first = 0;
+    uint64_t second = 0;
+    REQUIRE(wheel.Schedule(100U, 1U, first));
+    REQUIRE(wheel.Schedule(100U, 2U, second));
+    REQUIRE(wheel.Cancel(first));
+
+    REQUIRE(wheel.Advance(200U) == 1U);
+    REQUIRE(ReadExpired(wheel) == std::vector<uint32_t>{2U});
+
+    /* Cancelling an expired timer does not affect the timers reusing it */
+    REQUIRE(wheel.Cancel(second));
+    uint64_t third = 0;
+    for (size_t i = 0; i < 8U; i++) {
+        REQUIRE(wheel.Schedule(300U, 3U, third));
+    }
+    REQUIRE(wheel.Advance(300U) == 8U);
+}
+
+TEST_CASE("mpsc::TimerWheel - Timer exhaustion", "[tw_exhaustion]") {
+    lockfree::mpsc::TimerWheel<uint32_t, 4, 8, 8> wheel;
+
+    uint64_t handle = 0;
+    for (uint32_t i = 0; i < 4U; i++) {
+        REQUIRE(wheel.Schedule(10U, i, handle));
+    }
+    REQUIRE(!wheel.Schedule(10U, 4U, handle));
+
+    /* Timers are reusable once expired */
+    wheel.Advance(10U);
+    REQUIRE(wheel.Schedule(20U, 4U, handle));
+}
+
+TEST_CASE("mpsc::TimerWheel - Full expired ring buffer", "[tw_expired_full]") {
+    Wheel wheel;
+
+    uint64_t handle = 0;
+    for (uint32_t i = 0; i < 40U; i++) {
+        REQUIRE(wheel.Schedule(10U + i / 8U, i, handle));
+    }
+
+    /* One slot of the ring buffer always stays free */
+    std::vector<uint32_t> expired;
+    size_t total = 0U;
+    for (uint64_t now = 20U; total < 40U; now++) {
+        const size_t written = wheel.Advance(now);
+        REQUIRE(written <= 15U);
+        total += written;
+
+        const std::vector<uint32_t> read = ReadExpired(wheel);
+        expired.insert(expired.end(), read.begin(), read.end());
+    }
+
+    /* Timers are expired in deadline order, even when delayed */
+    REQUIRE(expired.size() == 40U);
+    for (size_t i = 1; i < expired.size(); i++) {
+        REQUIRE(expired[i] / 8U >= expired[i - 1] / 8U);
+    }
+}
+
+TEST_CASE("mpsc::TimerWheel - Multiple schedulers", "[tw_multithread]") {
+    lockfree::mpsc::TimerWheel<uint32_t, 1024, 1024, 1024> wheel;
+    constexpr size_t threads = 4U;
+    std::vector<std::thread> schedulers;
+
+    for (size_t t = 0; t < threads; t++) {
+        schedulers.emplace_back([&wheel, t]() {
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+                uint64_t handle = 0;
+                const uint32_t data = t * TEST_MT_TRANSFER_CNT + i;
+                while (!wheel.Schedule(i % 512U, data, handle)) {
+                    std::this_thread::yield();
+                }
+                /* Every other timer is cancelled, expired or not */
+                if (i % 2U == 1U) {
+                    while (!wheel.Cancel(handle)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+
+    std::atomic_size_t done(0U);
+    std::thread finisher([&schedulers, &done]() {
+        for (auto &scheduler : schedulers) {
+            scheduler.join();
+        }
+        done.store(1U);
+    });
+
+    /* Every timer that was not cancelled expires exactly once */
+    std::vector<uint8_t> seen(threads * TEST_MT_TRANSFER_CNT, 0U);
+    bool unique = true;
+    uint64_t now = 0U;
+    while (true) {
+        const bool finished = done.load() != 0U;
+        wheel.Advance(now);
+        now += 7U;
+
+        lockfree::mpsc::TimerWheel<uint32_t, 1024, 1024, 1024>::Expiration e;
+        while (wheel.GetExpired().Read(&e, 1)) {
+            unique = unique && seen[e.data] == 0U;
+            seen[e.data] = 1U;
+        }
+        if (finished && now > 1024U && wheel.Advance(now) == 0U &&
+            wheel.GetExpired().GetAvailable() == 0U) {
+            break;
+        }
+    }
+    finisher.join();
+
+    REQUIRE(unique);
+    for (size_t i = 0; i < seen.size(); i++) {
+        if ((i % TEST_MT_TRANSFER_CNT) % 2U == 0U) {
+            REQUIRE(seen[i] == 1U);
+        }
+    }
+}
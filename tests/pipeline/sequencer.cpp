@@ -0,0 +1,237 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+#include "pipeline/sequencer.hpp"
+
+TEST_CASE("pipeline::Sequencer - Claim, publish and acquire",
+          "[pl_seq_claim_publish]") {
+    lockfree::pipeline::Sequencer<int32_t, 16, 1> sequencer;
+
+    size_t stage = 0;
+    REQUIRE(sequencer.AddStage(stage));
+
+    size_t sequence = 0;
+    REQUIRE(sequencer.TryClaim(3, sequence));
+    for (size_t i = 0; i < 3U; i++) {
+        sequencer.Get(sequence + i) = -1024 + static_cast<int32_t>(i);
+    }
+
+    /* Claimed slots are not visible before they are published */
+    size_t acquired_sequence = 0;
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 0U);
+
+    sequencer.Publish(sequence, 3);
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 3U);
+    REQUIRE(acquired_sequence == sequence);
+    REQUIRE(sequencer.Get(acquired_sequence) == -1024);
+    REQUIRE(sequencer.Get(acquired_sequence + 2) == -1022);
+
+    /* Slots stay acquired until released */
+    sequencer.Release(stage, 2);
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 1U);
+    REQUIRE(acquired_sequence == sequence + 2U);
+}
+
+TEST_CASE("pipeline::Sequencer - Producer waits for the last stages",
+          "[pl_seq_gating]") {
+    lockfree::pipeline::Sequencer<uint32_t, 8, 2> sequencer;
+
+    /* Without stages, claims never fail */
+    size_t sequence = 0;
+    for (size_t i = 0; i < 4U; i++) {
+        REQUIRE(sequencer.TryClaim(8, sequence));
+        sequencer.Publish(sequence, 8);
+    }
+
+    size_t first = 0;
+    size_t second = 0;
+    REQUIRE(sequencer.AddStage(first));
+    REQUIRE(sequencer.AddStage(second, &first, 1));
+
+    REQUIRE(sequencer.TryClaim(8, sequence));
+    sequencer.Publish(sequence, 8);
+    REQUIRE(!sequencer.TryClaim(1, sequence));
+    REQUIRE(!sequencer.TryClaim(9, sequence));
+
+    /* Only the last stage releases slots to the producer */
+    size_t acquired_sequence = 0;
+    REQUIRE(sequencer.TryAcquire(first, acquired_sequence, 8) == 8U);
+    sequencer.Release(first, 8);
+    REQUIRE(!sequencer.TryClaim(1, sequence));
+
+    REQUIRE(sequencer.TryAcquire(second, acquired_sequence, 4) == 4U);
+    sequencer.Release(second, 4);
+    REQUIRE(sequencer.TryClaim(4, sequence));
+    REQUIRE(!sequencer.TryClaim(1, sequence));
+}
+
+TEST_CASE("pipeline::Sequencer - Stages wait for the stages before",
+          "[pl_seq_stages]") {
+    lockfree::pipeline::Sequencer<uint32_t, 16, 4> sequencer;
+
+    size_t decode = 0;
+    size_t enrich = 0;
+    REQUIRE(sequencer.AddStage(decode));
+    REQUIRE(sequencer.AddStage(enrich, &decode, 1));
+
+    /* Stages can only wait for existing stages */
+    size_t invalid = 3;
+    size_t stage = 0;
+    REQUIRE(!sequencer.AddStage(stage, &invalid, 1));
+
+    const size_t after_enrich[1] = {enrich};
+    size_t journal = 0;
+    size_t publish = 0;
+    REQUIRE(sequencer.AddStage(journal, after_enrich, 1));
+    REQUIRE(sequencer.AddStage(publish, after_enrich, 1));
+    REQUIRE(!sequencer.AddStage(stage));
+
+    const size_t sequence = sequencer.Claim(4);
+    sequencer.Publish(sequence, 4);
+
+    size_t acquired_sequence = 0;
+    REQUIRE(sequencer.TryAcquire(enrich, acquired_sequence, 8) == 0U);
+    REQUIRE(sequencer.Acquire(decode, acquired_sequence, 8) == 4U);
+    sequencer.Release(decode, 3);
+
+    REQUIRE(sequencer.TryAcquire(enrich, acquired_sequence, 8) == 3U);
+    sequencer.Release(enrich, 3);
+
+    /* Stages waiting for the same stage proceed independently */
+    REQUIRE(sequencer.TryAcquire(journal, acquired_sequence, 2) == 2U);
+    REQUIRE(sequencer.TryAcquire(publish, acquired_sequence, 8) == 3U);
+}
+
+TEST_CASE("pipeline::Sequencer - Out of order publishing",
+          "[pl_seq_out_of_order]") {
+    lockfree::pipeline::Sequencer<uint32_t, 8, 1, true> sequencer;
+
+    size_t stage = 0;
+    REQUIRE(sequencer.AddStage(stage));
+
+    size_t first = 0;
+    size_t second = 0;
+    REQUIRE(sequencer.TryClaim(2, first));
+    REQUIRE(sequencer.TryClaim(2, second));
+    REQUIRE(second == first + 2U);
+
+    /* Slots after an unpublished slot are not visible */
+    sequencer.Publish(second, 2);
+    size_t acquired_sequence = 0;
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 0U);
+
+    sequencer.Publish(first, 2);
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 4U);
+    sequencer.Release(stage, 4);
+
+    /* Slots of the next revolution are not mistaken as published */
+    REQUIRE(sequencer.TryClaim(8, first));
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 0U);
+    sequencer.Publish(first, 8);
+    REQUIRE(sequencer.TryAcquire(stage, acquired_sequence, 8) == 8U);
+}
+
+TEST_CASE("pipeline::Sequencer - Multithreaded pipeline",
+          "[pl_seq_multithread]") {
+    lockfree::pipeline::Sequencer<uint64_t, 64, 3> sequencer;
+
+    size_t doubler = 0;
+    size_t summer = 0;
+    size_t counter = 0;
+    REQUIRE(sequencer.AddStage(doubler));
+    const size_t after_doubler[1] = {doubler};
+    REQUIRE(sequencer.AddStage(summer, after_doubler, 1));
+    REQUIRE(sequencer.AddStage(counter, after_doubler, 1));
+
+    uint64_t sum = 0U;
+    uint64_t count = 0U;
+    std::vector<std::thread> threads;
+    threads.emplace_back([&sequencer, doubler]() {
+        for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT;) {
+            size_t sequence = 0;
+            const size_t acquired = sequencer.Acquire(doubler, sequence, 8);
+            for (size_t j = 0; j < acquired; j++) {
+                sequencer.Get(sequence + j) *= 2U;
+            }
+            sequencer.Release(doubler, acquired);
+            i += acquired;
+        }
+    });
+    threads.emplace_back([&sequencer, summer, &sum]() {
+        for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT;) {
+            size_t sequence = 0;
+            const size_t acquired = sequencer.Acquire(summer, sequence, 8);
+            for (size_t j = 0; j < acquired; j++) {
+                sum += sequencer.Get(sequence + j);
+            }
+            sequencer.Release(summer, acquired);
+            i += acquired;
+        }
+    });
+    threads.emplace_back([&sequencer, counter, &count]() {
+        for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT;) {
+            size_t sequence = 0;
+            const size_t acquired = sequencer.Acquire(counter, sequence, 3);
+            count += acquired;
+            sequencer.Release(counter, acquired);
+            i += acquired;
+        }
+    });
+
+    for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT; i += 4U) {
+        const size_t sequence = sequencer.Claim(4);
+        for (size_t j = 0; j < 4U; j++) {
+            sequencer.Get(sequence + j) = i + j;
+        }
+        sequencer.Publish(sequence, 4);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    const uint64_t total = TEST_MT_TRANSFER_CNT;
+    REQUIRE(sum == total * (total - 1U));
+    REQUIRE(count == total);
+}
+
+TEST_CASE("pipeline::Sequencer - Multiple producers",
+          "[pl_seq_multi_producer]") {
+    constexpr size_t producer_cnt = 3U;
+    lockfree::pipeline::Sequencer<uint32_t, 64, 1, true,
+                                  lockfree::pipeline::SleepWait>
+        sequencer;
+
+    size_t stage = 0;
+    REQUIRE(sequencer.AddStage(stage));
+
+    std::vector<std::thread> producers;
+    for (size_t t = 0; t < producer_cnt; t++) {
+        producers.emplace_back([&sequencer, t]() {
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i += 2U) {
+                const size_t sequence = sequencer.Claim(2);
+                sequencer.Get(sequence) = t * TEST_MT_TRANSFER_CNT + i;
+                sequencer.Get(sequence + 1) = t * TEST_MT_TRANSFER_CNT + i + 1;
+                sequencer.Publish(sequence, 2);
+            }
+        });
+    }
+
+    const uint64_t total = producer_cnt * TEST_MT_TRANSFER_CNT;
+    uint64_t sum = 0U;
+    for (uint64_t received = 0U; received < total;) {
+        size_t sequence = 0;
+        const size_t acquired = sequencer.Acquire(stage, sequence, 16);
+        for (size_t j = 0; j < acquired; j++) {
+            sum += sequencer.Get(sequence + j);
+        }
+        sequencer.Release(stage, acquired);
+        received += acquired;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(sum == total * (total - 1U) / 2U);
+}
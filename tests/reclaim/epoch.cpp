@@ -0,0 +1,213 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+#include "reclaim/epoch.hpp"
+
+namespace {
+
+struct Node {
+    std::atomic_bool alive;
+    size_t *deleted;
+};
+
+void MarkDeleted(void *ptr) {
+    Node *node = static_cast<Node *>(ptr);
+    node->alive.store(false, std::memory_order_relaxed);
+    if (node->deleted != nullptr) {
+        (*node->deleted)++;
+    }
+}
+
+struct Counted {
+    explicit Counted(size_t &destroyed) : _destroyed(destroyed) {}
+    ~Counted() { _destroyed++; }
+
+    size_t &_destroyed;
+};
+
+} // namespace
+
+TEST_CASE("reclaim::Epoch - Register up to the maximum thread count",
+          "[rc_epoch_register]") {
+    lockfree::reclaim::Epoch<2> epoch;
+
+    size_t first = 0;
+    size_t second = 0;
+    size_t third = 0;
+    REQUIRE(epoch.Register(first));
+    REQUIRE(epoch.Register(second));
+    REQUIRE(first != second);
+    REQUIRE(!epoch.Register(third));
+
+    epoch.Unregister(first);
+    REQUIRE(epoch.Register(third));
+    REQUIRE(third == first);
+}
+
+TEST_CASE("reclaim::Epoch - Objects outlive critical sections that started "
+          "before they were retired",
+          "[rc_epoch_guard]") {
+    lockfree::reclaim::Epoch<2> epoch;
+    size_t reader = 0;
+    size_t writer = 0;
+    REQUIRE(epoch.Register(reader));
+    REQUIRE(epoch.Register(writer));
+
+    size_t deleted = 0;
+    Node node;
+    node.alive.store(true);
+    node.deleted = &deleted;
+
+    {
+        lockfree::reclaim::Epoch<2>::Guard guard(epoch, reader);
+        REQUIRE(epoch.Retire(writer, &node, MarkDeleted));
+
+        for (size_t i = 0; i < 4U; i++) {
+            REQUIRE(epoch.Reclaim(writer) == 0U);
+        }
+        REQUIRE(node.alive.load());
+        REQUIRE(epoch.GetPending(writer) == 1U);
+    }
+
+    /* The epoch has to move on twice after the guard has been left */
+    epoch.Reclaim(writer);
+    epoch.Reclaim(writer);
+    REQUIRE(!node.alive.load());
+    REQUIRE(deleted == 1U);
+    REQUIRE(epoch.GetPending(writer) == 0U);
+}
+
+TEST_CASE("reclaim::Epoch - Nested guards", "[rc_epoch_nested]") {
+    lockfree::reclaim::Epoch<2> epoch;
+    size_t reader = 0;
+    size_t writer = 0;
+    REQUIRE(epoch.Register(reader));
+    REQUIRE(epoch.Register(writer));
+
+    Node node;
+    node.alive.store(true);
+    node.deleted = nullptr;
+
+    {
+        lockfree::reclaim::Epoch<2>::Guard outer(epoch, reader);
+        {
+            lockfree::reclaim::Epoch<2>::Guard inner(epoch, reader);
+        }
+        REQUIRE(epoch.Retire(writer, &node, MarkDeleted));
+        epoch.Reclaim(writer);
+        epoch.Reclaim(writer);
+        REQUIRE(node.alive.load());
+    }
+
+    epoch.Reclaim(writer);
+    epoch.Reclaim(writer);
+    REQUIRE(!node.alive.load());
+}
+
+TEST_CASE("reclaim::Epoch - Retire list is bounded", "[rc_epoch_bounded]") {
+    size_t deleted = 0;
+    std::vector<Node> nodes(9);
+    for (Node &node : nodes) {
+        node.alive.store(true);
+        node.deleted = &deleted;
+    }
+
+    lockfree::reclaim::Epoch<2, 8> epoch;
+    size_t reader = 0;
+    size_t writer = 0;
+    REQUIRE(epoch.Register(reader));
+    REQUIRE(epoch.Register(writer));
+
+    {
+        /* A stalled reader keeps every object from being deleted */
+        lockfree::reclaim::Epoch<2, 8>::Guard guard(epoch, reader);
+        for (size_t i = 0; i < 8U; i++) {
+            REQUIRE(epoch.Retire(writer, &nodes[i], MarkDeleted));
+        }
+        REQUIRE(!epoch.Retire(writer, &nodes[8], MarkDeleted));
+        REQUIRE(deleted == 0U);
+    }
+
+    epoch.Reclaim(writer);
+    epoch.Reclaim(writer);
+    REQUIRE(epoch.GetPending(writer) == 0U);
+    REQUIRE(epoch.Retire(writer, &nodes[8], MarkDeleted));
+    REQUIRE(deleted == 8U);
+}
+
+TEST_CASE("reclaim::Epoch - Pending objects are deleted with the epoch",
+          "[rc_epoch_destructor]") {
+    size_t destroyed = 0;
+    {
+        lockfree::reclaim::Epoch<1> epoch;
+        size_t thread = 0;
+        REQUIRE(epoch.Register(thread));
+
+        lockfree::reclaim::Epoch<1>::Guard guard(epoch, thread);
+        REQUIRE(epoch.Retire(thread, new Counted(destroyed)));
+        REQUIRE(epoch.Retire(thread, new Counted(destroyed)));
+        REQUIRE(epoch.GetPending(thread) == 2U);
+        REQUIRE(destroyed == 0U);
+    }
+    REQUIRE(destroyed == 2U);
+}
+
+TEST_CASE("reclaim::Epoch - Multithreaded readers and writer",
+          "[rc_epoch_multithread]") {
+    std::vector<Node> nodes(TEST_MT_TRANSFER_CNT + 1U);
+    for (Node &node : nodes) {
+        node.alive.store(true);
+        node.deleted = nullptr;
+    }
+
+    /* Declared after the nodes, so its destructor can still mark them */
+    lockfree::reclaim::Epoch<4, 64> epoch;
+    constexpr size_t readers = 3U;
+    std::atomic<Node *> current(&nodes[0]);
+    std::atomic_bool done(false);
+    std::vector<uint8_t> safe(readers, false);
+    std::vector<std::thread> threads;
+
+    for (size_t r = 0; r < readers; r++) {
+        threads.emplace_back([&epoch, &current, &done, &safe, r]() {
+            size_t thread = 0;
+            bool ok = epoch.Register(thread);
+            while (ok && !done.load()) {
+                lockfree::reclaim::Epoch<4, 64>::Guard guard(epoch, thread);
+                Node *node = current.load(std::memory_order_acquire);
+                for (size_t i = 0; i < 16U; i++) {
+                    ok = ok && node->alive.load(std::memory_order_relaxed);
+                }
+            }
+            epoch.Unregister(thread);
+            safe[r] = ok;
+        });
+    }
+
+    threads.emplace_back([&epoch, &current, &done, &nodes]() {
+        size_t thread = 0;
+        if (!epoch.Register(thread)) {
+            done.store(true);
+            return;
+        }
+        for (size_t i = 1; i < nodes.size(); i++) {
+            Node *old = current.exchange(&nodes[i], std::memory_order_acq_rel);
+            while (!epoch.Retire(thread, old, MarkDeleted)) {
+                std::this_thread::yield();
+            }
+        }
+        done.store(true);
+        epoch.Unregister(thread);
+    });
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t r = 0; r < readers; r++) {
+        REQUIRE(safe[r]);
+    }
+}
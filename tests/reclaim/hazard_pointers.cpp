@@ -0,0 +1,211 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+#include "reclaim/hazard_pointers.hpp"
+
+namespace {
+
+struct Node {
+    std::atomic_bool alive;
+    size_t *deleted;
+};
+
+void MarkDeleted(void *ptr) {
+    Node *node = static_cast<Node *>(ptr);
+    node->alive.store(false, std::memory_order_relaxed);
+    if (node->deleted != nullptr) {
+        (*node->deleted)++;
+    }
+}
+
+struct Counted {
+    explicit Counted(size_t &destroyed) : _destroyed(destroyed) {}
+    ~Counted() { _destroyed++; }
+
+    size_t &_destroyed;
+};
+
+} // namespace
+
+TEST_CASE("reclaim::HazardPointers - Register up to the maximum thread count",
+          "[rc_hp_register]") {
+    lockfree::reclaim::HazardPointers<2> hp;
+
+    size_t first = 0;
+    size_t second = 0;
+    size_t third = 0;
+    REQUIRE(hp.Register(first));
+    REQUIRE(hp.Register(second));
+    REQUIRE(first != second);
+    REQUIRE(!hp.Register(third));
+
+    hp.Unregister(first);
+    REQUIRE(hp.Register(third));
+    REQUIRE(third == first);
+}
+
+TEST_CASE("reclaim::HazardPointers - Protected objects are not deleted",
+          "[rc_hp_protect]") {
+    size_t deleted = 0;
+    Node first;
+    first.alive.store(true);
+    first.deleted = &deleted;
+    Node second;
+    second.alive.store(true);
+    second.deleted = &deleted;
+
+    lockfree::reclaim::HazardPointers<2> hp;
+    size_t reader = 0;
+    size_t writer = 0;
+    REQUIRE(hp.Register(reader));
+    REQUIRE(hp.Register(writer));
+
+    std::atomic<Node *> source(&first);
+    REQUIRE(hp.Protect(reader, 0, source) == &first);
+
+    source.store(&second);
+    hp.Retire(writer, &first, MarkDeleted);
+    REQUIRE(hp.Reclaim(writer) == 0U);
+    REQUIRE(first.alive.load());
+    REQUIRE(hp.GetPending(writer) == 1U);
+
+    /* Reusing the hazard pointer releases the first object */
+    REQUIRE(hp.Protect(reader, 0, source) == &second);
+    REQUIRE(hp.Reclaim(writer) == 1U);
+    REQUIRE(!first.alive.load());
+
+    source.store(nullptr);
+    hp.Retire(writer, &second, MarkDeleted);
+    REQUIRE(hp.Reclaim(writer) == 0U);
+    hp.Clear(reader, 0);
+    REQUIRE(hp.Reclaim(writer) == 1U);
+    REQUIRE(deleted == 2U);
+    REQUIRE(hp.Protect(reader, 1, source) == nullptr);
+}
+
+TEST_CASE("reclaim::HazardPointers - Set protects a known object",
+          "[rc_hp_set]") {
+    Node node;
+    node.alive.store(true);
+    node.deleted = nullptr;
+
+    lockfree::reclaim::HazardPointers<1, 1> hp;
+    size_t thread = 0;
+    REQUIRE(hp.Register(thread));
+
+    hp.Set(thread, 0, &node);
+    hp.Retire(thread, &node, MarkDeleted);
+    REQUIRE(hp.Reclaim(thread) == 0U);
+    REQUIRE(node.alive.load());
+
+    hp.Clear(thread, 0);
+    REQUIRE(hp.Reclaim(thread) == 1U);
+    REQUIRE(!node.alive.load());
+}
+
+TEST_CASE("reclaim::HazardPointers - Pending objects are bounded",
+          "[rc_hp_bounded]") {
+    size_t deleted = 0;
+    std::vector<Node> nodes(64);
+    for (Node &node : nodes) {
+        node.alive.store(true);
+        node.deleted = &deleted;
+    }
+
+    lockfree::reclaim::HazardPointers<2, 2, 8> hp;
+    size_t reader = 0;
+    size_t writer = 0;
+    REQUIRE(hp.Register(reader));
+    REQUIRE(hp.Register(writer));
+
+    /* Even with a reader holding on to objects, retiring never blocks */
+    hp.Set(reader, 0, &nodes[0]);
+    hp.Set(reader, 1, &nodes[1]);
+    for (Node &node : nodes) {
+        hp.Retire(writer, &node, MarkDeleted);
+        REQUIRE(hp.GetPending(writer) < 8U);
+    }
+    REQUIRE(nodes[0].alive.load());
+    REQUIRE(nodes[1].alive.load());
+
+    hp.Unregister(reader);
+    hp.Reclaim(writer);
+    REQUIRE(hp.GetPending(writer) == 0U);
+    REQUIRE(deleted == nodes.size());
+}
+
+TEST_CASE("reclaim::HazardPointers - Pending objects are deleted with the "
+          "hazard pointers",
+          "[rc_hp_destructor]") {
+    size_t destroyed = 0;
+    {
+        lockfree::reclaim::HazardPointers<1> hp;
+        size_t thread = 0;
+        REQUIRE(hp.Register(thread));
+
+        hp.Retire(thread, new Counted(destroyed));
+        hp.Retire(thread, new Counted(destroyed));
+        REQUIRE(hp.GetPending(thread) == 2U);
+        REQUIRE(destroyed == 0U);
+    }
+    REQUIRE(destroyed == 2U);
+}
+
+TEST_CASE("reclaim::HazardPointers - Multithreaded readers and writer",
+          "[rc_hp_multithread]") {
+    std::vector<Node> nodes(TEST_MT_TRANSFER_CNT + 1U);
+    for (Node &node : nodes) {
+        node.alive.store(true);
+        node.deleted = nullptr;
+    }
+
+    /* Declared after the nodes, so its destructor can still mark them */
+    lockfree::reclaim::HazardPointers<4, 1> hp;
+    constexpr size_t readers = 3U;
+
+    std::atomic<Node *> current(&nodes[0]);
+    std::atomic_bool done(false);
+    std::vector<uint8_t> safe(readers, false);
+    std::vector<std::thread> threads;
+
+    for (size_t r = 0; r < readers; r++) {
+        threads.emplace_back([&hp, &current, &done, &safe, r]() {
+            size_t thread = 0;
+            bool ok = hp.Register(thread);
+            while (ok && !done.load()) {
+                Node *node = hp.Protect(thread, 0, current);
+                for (size_t i = 0; i < 16U; i++) {
+                    ok = ok && node->alive.load(std::memory_order_relaxed);
+                }
+                hp.Clear(thread, 0);
+            }
+            hp.Unregister(thread);
+            safe[r] = ok;
+        });
+    }
+
+    threads.emplace_back([&hp, &current, &done, &nodes]() {
+        size_t thread = 0;
+        if (!hp.Register(thread)) {
+            done.store(true);
+            return;
+        }
+        for (size_t i = 1; i < nodes.size(); i++) {
+            Node *old = current.exchange(&nodes[i], std::memory_order_acq_rel);
+            hp.Retire(thread, old, MarkDeleted);
+        }
+        done.store(true);
+        hp.Unregister(thread);
+    });
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t r = 0; r < readers; r++) {
+        REQUIRE(safe[r]);
+    }
+}
@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "lockfree.hpp"
+#include "shm/segment.hpp"
+
+namespace {
+std::string SegmentName(const char *test) {
+    return std::string("/lockfree_test_") + test + "_" +
+           std::to_string(getpid());
+}
+} // namespace
+
+TEST_CASE("shm::Segment - Create and attach", "[shm_create_attach]") {
+    const std::string name = SegmentName("create_attach");
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> producer;
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> consumer;
+
+    REQUIRE(producer.Get() == nullptr);
+    REQUIRE(producer.Create(name.c_str()));
+    REQUIRE(consumer.Attach(name.c_str()));
+
+    /* Two separate mappings of the same memory */
+    REQUIRE(producer.Get() != nullptr);
+    REQUIRE(consumer.Get() != nullptr);
+    REQUIRE(producer.Get() != consumer.Get());
+
+    REQUIRE(producer.Get()->Push(0xDEADBEEFU));
+    uint32_t read = 0;
+    REQUIRE(consumer.Get()->Pop(read));
+    REQUIRE(read == 0xDEADBEEFU);
+
+    REQUIRE(lockfree::shm::Segment<
+            lockfree::spsc::Queue<uint32_t, 64U>>::Unlink(name.c_str()));
+}
+
+TEST_CASE("shm::Segment - Create existing", "[shm_create_existing]") {
+    const std::string name = SegmentName("create_existing");
+    lockfree::shm::Segment<lockfree::spsc::RingBuf<uint8_t, 128U>> first;
+    lockfree::shm::Segment<lockfree::spsc::RingBuf<uint8_t, 128U>> second;
+
+    REQUIRE(first.Create(name.c_str()));
+    REQUIRE(!second.Create(name.c_str()));
+    REQUIRE(second.Get() == nullptr);
+
+    lockfree::shm::Segment<lockfree::spsc::RingBuf<uint8_t, 128U>>::Unlink(
+        name.c_str());
+}
+
+TEST_CASE("shm::Segment - Attach nonexistent", "[shm_attach_nonexistent]") {
+    const std::string name = SegmentName("attach_nonexistent");
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> segment;
+
+    REQUIRE(!segment.Attach(name.c_str()));
+    REQUIRE(segment.Get() == nullptr);
+}
+
+TEST_CASE("shm::Segment - Attach with incompatible layout",
+          "[shm_attach_incompatible]") {
+    const std::string name = SegmentName("attach_incompatible");
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> creator;
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 128U>> bigger;
+    lockfree::shm::Segment<lockfree::spsc::BipartiteBuf<uint32_t, 64U>>
+        different;
+
+    REQUIRE(creator.Create(name.c_str()));
+    REQUIRE(!bigger.Attach(name.c_str()));
+    REQUIRE(!different.Attach(name.c_str()));
+
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>>::Unlink(
+        name.c_str());
+}
+
+TEST_CASE("shm::Segment - Detach", "[shm_detach]") {
+    const std::string name = SegmentName("detach");
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> creator;
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>> segment;
+
+    REQUIRE(creator.Create(name.c_str()));
+    creator.Get()->Push(42U);
+    creator.Detach();
+    REQUIRE(creator.Get() == nullptr);
+
+    /* The segment and its contents outlive the creator mapping */
+    REQUIRE(segment.Attach(name.c_str()));
+    uint32_t read = 0;
+    REQUIRE(segment.Get()->Pop(read));
+    REQUIRE(read == 42U);
+
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint32_t, 64U>>::Unlink(
+        name.c_str());
+}
+
+TEST_CASE("shm::Segment - Multiprocess read/write", "[shm_multiprocess]") {
+    const std::string name = SegmentName("multiprocess");
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint64_t, 1024U>> segment;
+    REQUIRE(segment.Create(name.c_str()));
+
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+
+    // producer
+    if (pid == 0) {
+        lockfree::shm::Segment<lockfree::spsc::Queue<uint64_t, 1024U>> child;
+        if (!child.Attach(name.c_str())) {
+            _exit(1);
+        }
+
+        uint64_t element = 0;
+        do {
+            if (child.Get()->Push(element)) {
+                element++;
+            }
+        } while (element < TEST_MT_TRANSFER_CNT);
+        _exit(0);
+    }
+
+    // consumer
+    bool in_order = true;
+    uint64_t expected = 0;
+    do {
+        uint64_t element = 0;
+        if (segment.Get()->Pop(element)) {
+            in_order = in_order && (element == expected);
+            expected++;
+        }
+    } while (expected < TEST_MT_TRANSFER_CNT);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    lockfree::shm::Segment<lockfree::spsc::Queue<uint64_t, 1024U>>::Unlink(
+        name.c_str());
+
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(in_order);
+}
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+TEST_CASE("spmc::BroadcastBuf - Every consumer reads every element",
+          "[spmc_bb_broadcast]") {
+    lockfree::spmc::BroadcastBuf<int16_t, 16, 3> buf;
+
+    size_t first = 0;
+    size_t second = 0;
+    REQUIRE(buf.Register(first));
+    REQUIRE(buf.Register(second));
+    REQUIRE(first != second);
+
+    const int16_t test_data[4] = {-1024, 0, 1, 1024};
+    REQUIRE(buf.Write(test_data, 4));
+    REQUIRE(buf.GetAvailable(first) == 4U);
+    REQUIRE(buf.GetAvailable(second) == 4U);
+
+    int16_t read[4] = {};
+    REQUIRE(buf.Read(first, read, 4));
+    REQUIRE(std::equal(std::begin(test_data), std::end(test_data),
+                       std::begin(read)));
+
+    /* The other consumer still has all of the data */
+    int16_t read_second[4] = {};
+    REQUIRE(buf.Read(second, read_second, 4));
+    REQUIRE(std::equal(std::begin(test_data), std::end(test_data),
+                       std::begin(read_second)));
+
+    REQUIRE(!buf.Read(first, read, 1));
+}
+
+TEST_CASE("spmc::BroadcastBuf - Registration", "[spmc_bb_registration]") {
+    lockfree::spmc::BroadcastBuf<uint8_t, 8, 2> buf;
+
+    size_t consumers[2] = {};
+    REQUIRE(buf.Register(consumers[0]));
+    REQUIRE(buf.Register(consumers[1]));
+    size_t extra = 0;
+    REQUIRE(!buf.Register(extra));
+
+    buf.Unregister(consumers[1]);
+    REQUIRE(buf.Register(extra));
+    REQUIRE(extra == consumers[1]);
+}
+
+TEST_CASE("spmc::BroadcastBuf - Late consumers start at the newest data",
+          "[spmc_bb_late_consumer]") {
+    lockfree::spmc::BroadcastBuf<uint32_t, 8, 2> buf;
+
+    const uint32_t old_data[3] = {1U, 2U, 3U};
+    REQUIRE(buf.Write(old_data, 3));
+
+    size_t consumer = 0;
+    REQUIRE(buf.Register(consumer));
+    REQUIRE(buf.GetAvailable(consumer) == 0U);
+
+    REQUIRE(buf.Write(old_data, 1));
+    uint32_t read = 0;
+    REQUIRE(buf.Read(consumer, &read, 1));
+    REQUIRE(read == 1U);
+}
+
+TEST_CASE("spmc::BroadcastBuf - Producer waits for the slowest consumer",
+          "[spmc_bb_slowest]") {
+    lockfree::spmc::BroadcastBuf<uint32_t, 8, 2> buf;
+
+    /* Without consumers, writes never fail */
+    std::array<uint32_t, 8> data = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    for (size_t i = 0; i < 4U; i++) {
+        REQUIRE(buf.Write(data));
+    }
+
+    size_t fast = 0;
+    size_t slow = 0;
+    REQUIRE(buf.Register(fast));
+    REQUIRE(buf.Register(slow));
+
+    REQUIRE(buf.Write(data.data(), 6));
+    REQUIRE(!buf.Write(data.data(), 3));
+
+    std::array<uint32_t, 6> read = {};
+    REQUIRE(buf.Read(fast, read));
+    REQUIRE(!buf.Write(data.data(), 3));
+
+    REQUIRE(buf.Read(slow, read.data(), 2));
+    REQUIRE(read[0] == 0U);
+    REQUIRE(read[1] == 1U);
+    REQUIRE(buf.Write(data.data() + 6, 2));
+    REQUIRE(buf.Write(data.data(), 2));
+    REQUIRE(!buf.Write(data.data(), 1));
+
+    /* The slow consumer catches up */
+    REQUIRE(buf.Read(slow, read));
+    REQUIRE(read[0] == 2U);
+    REQUIRE(read[3] == 5U);
+    REQUIRE(read[4] == 6U);
+    REQUIRE(read[5] == 7U);
+
+    /* An unregistered consumer no longer holds up the producer */
+    REQUIRE(!buf.Write(data.data(), 5));
+    buf.Unregister(fast);
+    REQUIRE(buf.Write(data.data(), 6));
+}
+
+TEST_CASE("spmc::BroadcastBuf - Wrap around", "[spmc_bb_wrap]") {
+    lockfree::spmc::BroadcastBuf<uint16_t, 8, 1> buf;
+
+    size_t consumer = 0;
+    REQUIRE(buf.Register(consumer));
+
+    const uint16_t test_data[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+    uint16_t read[6] = {};
+    for (size_t i = 0; i < 3U; i++) {
+        REQUIRE(buf.Write(test_data, 6));
+        REQUIRE(buf.Read(consumer, read, 6));
+        REQUIRE(std::equal(std::begin(test_data), std::end(test_data),
+                           std::begin(read)));
+    }
+}
+
+TEST_CASE("spmc::BroadcastBuf - Lossy overrun", "[spmc_bb_lossy]") {
+    lockfree::spmc::BroadcastBuf<uint32_t, 8, 2, true> buf;
+
+    size_t consumer = 0;
+    REQUIRE(buf.Register(consumer));
+
+    /* The producer overwrites data the consumer has not read */
+    for (uint32_t i = 0; i < 12U; i++) {
+        REQUIRE(buf.Write(&i, 1));
+    }
+    REQUIRE(buf.GetAvailable(consumer) == 8U);
+
+    uint32_t read[4] = {};
+    REQUIRE(!buf.Read(consumer, read, 1));
+    REQUIRE(buf.GetOverrun(consumer) == 4U);
+
+    /* The consumer continues from the oldest data in the buffer */
+    REQUIRE(buf.Read(consumer, read, 4));
+    REQUIRE(read[0] == 4U);
+    REQUIRE(read[3] == 7U);
+    REQUIRE(buf.GetAvailable(consumer) == 4U);
+}
+
+TEST_CASE("spmc::BroadcastBuf - Write and read too much",
+          "[spmc_bb_too_much]") {
+    lockfree::spmc::BroadcastBuf<uint8_t, 8, 1> buf;
+
+    size_t consumer = 0;
+    REQUIRE(buf.Register(consumer));
+
+    uint8_t data[9] = {};
+    REQUIRE(!buf.Write(data, 9));
+    REQUIRE(buf.Write(data, 8));
+    REQUIRE(!buf.Read(consumer, data, 9));
+}
+
+TEST_CASE("spmc::BroadcastBuf - Multiple consumers",
+          "[spmc_bb_multithread]") {
+    constexpr size_t consumer_cnt = 3U;
+    lockfree::spmc::BroadcastBuf<uint32_t, 256, consumer_cnt> buf;
+    std::vector<std::thread> consumers;
+    std::vector<uint8_t> in_order(consumer_cnt, false);
+    std::atomic_size_t registered(0U);
+
+    for (size_t t = 0; t < consumer_cnt; t++) {
+        consumers.emplace_back([&buf, &in_order, &registered, t]() {
+            size_t consumer = 0;
+            if (!buf.Register(consumer)) {
+                return;
+            }
+            registered++;
+
+            bool ordered = true;
+            uint32_t read[8] = {};
+            for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i += 8U) {
+                while (!buf.Read(consumer, read, 8)) {
+                    std::this_thread::yield();
+                }
+                for (uint32_t j = 0; j < 8U; j++) {
+                    ordered = ordered && (read[j] == i + j);
+                }
+            }
+            in_order[t] = ordered;
+        });
+    }
+
+    /* Wait for the consumers, so none of them misses data */
+    while (registered.load() < consumer_cnt) {
+        std::this_thread::yield();
+    }
+    for (uint32_t i = 0; i < TEST_MT_TRANSFER_CNT; i += 8U) {
+        uint32_t data[8];
+        for (uint32_t j = 0; j < 8U; j++) {
+            data[j] = i + j;
+        }
+        while (!buf.Write(data, 8)) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &consumer : consumers) {
+        consumer.join();
+    }
+
+    for (size_t t = 0; t < consumer_cnt; t++) {
+        REQUIRE(in_order[t]);
+    }
+}
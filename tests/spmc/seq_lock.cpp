@@ -0,0 +1,95 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+namespace {
+struct PriceLevel {
+    uint64_t version;
+    uint32_t prices[61];
+    uint16_t odd_sized_tail;
+};
+} // namespace
+
+TEST_CASE("spmc::SeqLock - Read before write", "[sl_read_empty]") {
+    lockfree::spmc::SeqLock<uint32_t> seq_lock;
+
+    uint32_t read = 1U;
+    REQUIRE(seq_lock.TryRead(read));
+    REQUIRE(read == 0U);
+}
+
+TEST_CASE("spmc::SeqLock - Write and read back", "[sl_write_read]") {
+    lockfree::spmc::SeqLock<PriceLevel> seq_lock;
+
+    PriceLevel level = {};
+    level.version = 7U;
+    level.prices[60] = 1024U;
+    level.odd_sized_tail = 3U;
+    seq_lock.Write(level);
+
+    PriceLevel read = {};
+    seq_lock.Read(read);
+    REQUIRE(read.version == 7U);
+    REQUIRE(read.prices[60] == 1024U);
+    REQUIRE(read.odd_sized_tail == 3U);
+
+    level.version = 8U;
+    seq_lock.Write(level);
+    REQUIRE(seq_lock.TryRead(read));
+    REQUIRE(read.version == 8U);
+}
+
+TEST_CASE("spmc::SeqLock - Multithreaded consistency", "[sl_multithread]") {
+    lockfree::spmc::SeqLock<PriceLevel> seq_lock;
+    constexpr size_t reader_cnt = 3U;
+    std::atomic_bool done(false);
+    std::vector<uint8_t> consistent(reader_cnt, false);
+    std::vector<std::thread> readers;
+
+    auto make_level = [](uint64_t version) {
+        PriceLevel level;
+        level.version = version;
+        for (size_t i = 0; i < 61U; i++) {
+            level.prices[i] = static_cast<uint32_t>(version + i);
+        }
+        level.odd_sized_tail = static_cast<uint16_t>(version);
+        return level;
+    };
+    seq_lock.Write(make_level(0U));
+
+    for (size_t t = 0; t < reader_cnt; t++) {
+        readers.emplace_back([&seq_lock, &done, &consistent, t]() {
+            bool ok = true;
+            uint64_t last = 0U;
+            PriceLevel read = {};
+            while (!done.load()) {
+                seq_lock.Read(read);
+                /* Values are never torn, and never go back in time */
+                ok = ok && read.version >= last;
+                for (size_t i = 0; i < 61U; i++) {
+                    ok = ok && read.prices[i] == read.version + i;
+                }
+                ok = ok &&
+                     read.odd_sized_tail == static_cast<uint16_t>(read.version);
+                last = read.version;
+            }
+            consistent[t] = ok;
+        });
+    }
+
+    for (uint64_t v = 1; v <= TEST_MT_TRANSFER_CNT; v++) {
+        seq_lock.Write(make_level(v));
+    }
+    done.store(true);
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    for (size_t t = 0; t < reader_cnt; t++) {
+        REQUIRE(consistent[t]);
+    }
+}
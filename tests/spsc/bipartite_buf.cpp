@@ -206,6 +206,86 @@ TEST_CASE("spsc::BipartiteBuf - Test keeping the chunk of data when write ends "
     REQUIRE((read_buf_second_half - base) == (write_buf_second_half - base));
 }
 
+TEST_CASE("spsc::BipartiteBuf - Acquire max with an empty buffer",
+          "[bb_acquire_max_empty]") {
+    lockfree::spsc::BipartiteBuf<uint8_t, 512U> bb;
+
+    auto write = bb.WriteAcquireMax(1U);
+    REQUIRE(write.first != nullptr);
+    REQUIRE(write.second == 511U);
+
+    write = bb.WriteAcquireMax(512U);
+    REQUIRE(write.first == nullptr);
+    REQUIRE(write.second == 0U);
+}
+
+TEST_CASE("spsc::BipartiteBuf - Acquire max picks the bigger region",
+          "[bb_acquire_max_bigger]") {
+    lockfree::spsc::BipartiteBuf<uint8_t, 512U> bb;
+
+    /* Leave 112 elements until the end and 299 from the start */
+    bb.WriteAcquire(400U);
+    bb.WriteRelease(400U);
+    bb.ReadAcquire();
+    bb.ReadRelease(300U);
+
+    auto write = bb.WriteAcquireMax(1U);
+    REQUIRE(write.second == 299U);
+    std::fill(write.first, write.first + write.second, 0x5AU);
+    bb.WriteRelease(write.second);
+
+    /* The data until the old write index is read first, then the wrapped
+     * write */
+    auto read = bb.ReadAcquire();
+    REQUIRE(read.second == 100U);
+    bb.ReadRelease(read.second);
+
+    read = bb.ReadAcquire();
+    REQUIRE(read.second == 299U);
+    REQUIRE(read.first == write.first);
+    REQUIRE(std::all_of(read.first, read.first + read.second,
+                        [](uint8_t b) { return b == 0x5AU; }));
+}
+
+TEST_CASE("spsc::BipartiteBuf - Acquire max prefers the region until the end",
+          "[bb_acquire_max_linear]") {
+    lockfree::spsc::BipartiteBuf<uint8_t, 512U> bb;
+
+    /* Leave 312 elements until the end and 99 from the start */
+    bb.WriteAcquire(200U);
+    bb.WriteRelease(200U);
+    bb.ReadAcquire();
+    bb.ReadRelease(100U);
+
+    auto write = bb.WriteAcquireMax(100U);
+    REQUIRE(write.second == 312U);
+    bb.WriteRelease(write.second);
+
+    /* Requiring more than either region fails */
+    bb.ReadAcquire();
+    bb.ReadRelease(100U);
+    write = bb.WriteAcquireMax(300U);
+    REQUIRE(write.first == nullptr);
+
+    auto read = bb.ReadAcquire();
+    REQUIRE(read.second == 312U);
+}
+
+TEST_CASE("spsc::BipartiteBuf - Acquire max std::span API",
+          "[bb_acquire_max_span]") {
+    lockfree::spsc::BipartiteBuf<uint32_t, 256U> bb;
+
+    auto write_span = bb.WriteAcquireMaxSpan(16U);
+    REQUIRE(write_span.size() == 255U);
+    bb.WriteRelease(write_span.first(16U));
+
+    auto read_span = bb.ReadAcquireSpan();
+    REQUIRE(read_span.size() == 16U);
+    REQUIRE(read_span.data() == write_span.data());
+
+    REQUIRE(bb.WriteAcquireMaxSpan(240U).empty());
+}
+
 TEST_CASE("spsc::BipartiteBuf - std::span API test", "[bb_std_span_api]") {
     lockfree::spsc::BipartiteBuf<double, 512U> bb;
 
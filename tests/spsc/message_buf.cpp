@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+
+TEST_CASE("spsc::MessageBuf - Write a message and read it back",
+          "[mb_write_read]") {
+    lockfree::spsc::MessageBuf<512U> mb;
+    const uint8_t test_data[37] = {0xE5U, 0x12U, 0x34U};
+
+    uint8_t *payload = mb.Reserve(sizeof(test_data));
+    REQUIRE(payload != nullptr);
+    std::copy(std::begin(test_data), std::end(test_data), payload);
+    mb.Commit();
+
+    auto message = mb.Front();
+    REQUIRE(message.first != nullptr);
+    REQUIRE(message.second == sizeof(test_data));
+    REQUIRE(
+        std::equal(std::begin(test_data), std::end(test_data), message.first));
+
+    REQUIRE(mb.Pop());
+    REQUIRE(mb.Front().first == nullptr);
+    REQUIRE(!mb.Pop());
+}
+
+TEST_CASE("spsc::MessageBuf - Read empty", "[mb_read_empty]") {
+    lockfree::spsc::MessageBuf<256U> mb;
+
+    auto message = mb.Front();
+    REQUIRE(message.first == nullptr);
+    REQUIRE(message.second == 0U);
+    REQUIRE(!mb.Pop());
+}
+
+TEST_CASE("spsc::MessageBuf - Payload alignment", "[mb_alignment]") {
+    lockfree::spsc::MessageBuf<1024U, 32U> mb;
+
+    for (size_t len = 0; len < 5; len++) {
+        uint8_t *payload = mb.Reserve(len * 7U);
+        REQUIRE(payload != nullptr);
+        REQUIRE(reinterpret_cast<uintptr_t>(payload) % 32U == 0U);
+        mb.Commit();
+    }
+
+    for (size_t len = 0; len < 5; len++) {
+        auto message = mb.Front();
+        REQUIRE(reinterpret_cast<uintptr_t>(message.first) % 32U == 0U);
+        REQUIRE(message.second == len * 7U);
+        REQUIRE(mb.Pop());
+    }
+}
+
+TEST_CASE("spsc::MessageBuf - Commit less than reserved",
+          "[mb_commit_partial]") {
+    lockfree::spsc::MessageBuf<512U> mb;
+
+    uint8_t *payload = mb.Reserve(200U);
+    REQUIRE(payload != nullptr);
+    const char hello[] = "hello";
+    memcpy(payload, hello, sizeof(hello));
+    mb.Commit(sizeof(hello));
+
+    /* The space not committed is available for the next message */
+    payload = mb.Reserve(100U);
+    REQUIRE(payload != nullptr);
+    mb.Commit(1U);
+
+    auto message = mb.Front();
+    REQUIRE(message.second == sizeof(hello));
+    REQUIRE(memcmp(message.first, hello, sizeof(hello)) == 0);
+    REQUIRE(mb.Pop());
+    REQUIRE(mb.Front().second == 1U);
+}
+
+TEST_CASE("spsc::MessageBuf - Try to reserve too much", "[mb_reserve_full]") {
+    lockfree::spsc::MessageBuf<256U> mb;
+
+    REQUIRE(mb.Reserve(256U) == nullptr);
+    REQUIRE(mb.Reserve(static_cast<size_t>(-1)) == nullptr);
+
+    /* Header and payload need to fit next to the unused slot */
+    REQUIRE(mb.Reserve(256U - 2U * sizeof(size_t)) != nullptr);
+}
+
+TEST_CASE("spsc::MessageBuf - Iterate over multiple messages",
+          "[mb_iterate]") {
+    lockfree::spsc::MessageBuf<1024U> mb;
+
+    for (uint8_t i = 0; i < 10U; i++) {
+        uint8_t *payload = mb.Reserve(i);
+        REQUIRE(payload != nullptr);
+        std::fill(payload, payload + i, i);
+        mb.Commit();
+    }
+
+    uint8_t expected = 0;
+    for (auto message = mb.Front(); message.first != nullptr;
+         message = mb.Front()) {
+        REQUIRE(message.second == expected);
+        REQUIRE(std::all_of(message.first, message.first + message.second,
+                            [&](uint8_t b) { return b == expected; }));
+        REQUIRE(mb.Pop());
+        expected++;
+    }
+    REQUIRE(expected == 10U);
+}
+
+TEST_CASE("spsc::MessageBuf - Wrap around the end of the buffer",
+          "[mb_wrap]") {
+    lockfree::spsc::MessageBuf<256U> mb;
+
+    /* Move the indexes towards the end of the buffer */
+    REQUIRE(mb.Reserve(150U) != nullptr);
+    mb.Commit();
+    REQUIRE(mb.Pop());
+
+    /* Does not fit until the end, has to wrap to the beginning */
+    uint8_t *payload = mb.Reserve(80U);
+    REQUIRE(payload != nullptr);
+    std::fill(payload, payload + 80U, 0xA5U);
+    mb.Commit();
+
+    auto message = mb.Front();
+    REQUIRE(message.second == 80U);
+    REQUIRE(std::all_of(message.first, message.first + message.second,
+                        [](uint8_t b) { return b == 0xA5U; }));
+    REQUIRE(mb.Pop());
+    REQUIRE(!mb.Pop());
+}
+
+TEST_CASE("spsc::MessageBuf - std::span API", "[mb_span_api]") {
+    lockfree::spsc::MessageBuf<512U> mb;
+
+    auto reserved = mb.ReserveSpan(12U);
+    REQUIRE(reserved.size() == 12U);
+    std::fill(reserved.begin(), reserved.end(), 0x42U);
+    mb.Commit();
+
+    REQUIRE(mb.ReserveSpan(1024U).empty());
+
+    auto message = mb.FrontSpan();
+    REQUIRE(message.size() == 12U);
+    REQUIRE(std::all_of(message.begin(), message.end(),
+                        [](uint8_t b) { return b == 0x42U; }));
+    REQUIRE(mb.Pop());
+    REQUIRE(mb.FrontSpan().data() == nullptr);
+}
+
+TEST_CASE("spsc::MessageBuf - Multithreaded read/write", "[mb_multithread]") {
+    std::vector<std::thread> threads;
+    lockfree::spsc::MessageBuf<2048U> mb;
+    std::vector<uint8_t> written;
+    std::vector<uint8_t> read;
+
+    // consumer
+    threads.emplace_back([&]() {
+        size_t read_count = 0;
+        do {
+            auto message = mb.Front();
+            if (message.first != nullptr) {
+                read.insert(read.end(), message.first,
+                            message.first + message.second);
+                read_count++;
+                mb.Pop();
+            }
+        } while (read_count < TEST_MT_TRANSFER_CNT);
+    });
+
+    // producer
+    threads.emplace_back([&]() {
+        size_t write_count = 0;
+        do {
+            /* Vary the message length, including empty messages */
+            const size_t len = (write_count * 13U) % 97U;
+            uint8_t *payload = mb.Reserve(len);
+            if (payload != nullptr) {
+                for (size_t i = 0; i < len; i++) {
+                    payload[i] = static_cast<uint8_t>(write_count + i);
+                }
+                written.insert(written.end(), payload, payload + len);
+                mb.Commit();
+                write_count++;
+            }
+        } while (write_count < TEST_MT_TRANSFER_CNT);
+    });
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    REQUIRE(written == read);
+}
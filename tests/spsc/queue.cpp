@@ -90,6 +90,66 @@ TEST_CASE("spsc::Queue - Optional API", "[q_optional_api]") {
     REQUIRE(queue.Pop() == -1024);
 }
 
+TEST_CASE("spsc::Queue - Size estimation", "[q_size_approx]") {
+    lockfree::spsc::Queue<uint32_t, 4> queue;
+    REQUIRE(queue.SizeApprox() == 0U);
+    REQUIRE(queue.EmptyApprox());
+    REQUIRE(!queue.FullApprox());
+
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 10U; i++) {
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.SizeApprox() == 2U);
+        REQUIRE(!queue.EmptyApprox());
+
+        REQUIRE(queue.Push(i));
+        REQUIRE(queue.FullApprox());
+        REQUIRE(queue.SizeApprox() == 3U);
+
+        REQUIRE(queue.Pop(read));
+        REQUIRE(queue.Pop(read));
+        REQUIRE(queue.Pop(read));
+        REQUIRE(queue.EmptyApprox());
+    }
+}
+
+TEST_CASE("spsc::Queue - Stats", "[q_stats]") {
+    lockfree::spsc::Queue<uint32_t, 4, lockfree::Stats> queue;
+
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read));
+
+    REQUIRE(queue.Push(1U));
+    REQUIRE(queue.Push(2U));
+    REQUIRE(queue.Push(3U));
+    REQUIRE(!queue.Push(4U));
+    REQUIRE(!queue.Push(4U));
+
+    REQUIRE(queue.Pop(read));
+    REQUIRE(queue.Pop(read));
+    REQUIRE(queue.Push(5U));
+
+    const lockfree::StatsSnapshot stats = queue.GetStats();
+    REQUIRE(stats.push_full == 2U);
+    REQUIRE(stats.pop_empty == 1U);
+    REQUIRE(stats.high_water == 3U);
+    REQUIRE(stats.push_retries == 0U);
+    REQUIRE(stats.pop_retries == 0U);
+}
+
+TEST_CASE("spsc::Queue - No stats by default", "[q_no_stats]") {
+    lockfree::spsc::Queue<uint32_t, 4> queue;
+
+    uint32_t read = 0;
+    REQUIRE(!queue.Pop(read));
+    REQUIRE(queue.Push(1U));
+
+    const lockfree::StatsSnapshot stats = queue.GetStats();
+    REQUIRE(stats.pop_empty == 0U);
+    REQUIRE(stats.high_water == 0U);
+}
+
 TEST_CASE("spsc::Queue - Multithreaded read/write", "[q_multithread]") {
     std::vector<std::thread> threads;
     lockfree::spsc::Queue<uint64_t, 1024U> queue;
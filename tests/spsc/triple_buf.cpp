@@ -0,0 +1,112 @@
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "lockfree.hpp"
+
+namespace {
+struct Pose {
+    uint64_t stamp;
+    double position[3];
+};
+} // namespace
+
+TEST_CASE("spsc::TripleBuf - Read before write", "[tb_read_empty]") {
+    lockfree::spsc::TripleBuf<uint32_t> buf;
+
+    REQUIRE(!buf.HasNew());
+
+    uint32_t read = 1U;
+    REQUIRE(!buf.Read(read));
+    REQUIRE(read == 0U);
+}
+
+TEST_CASE("spsc::TripleBuf - Write and read back", "[tb_write_read]") {
+    lockfree::spsc::TripleBuf<int16_t> buf;
+
+    buf.Write(-1024);
+    REQUIRE(buf.HasNew());
+
+    int16_t read = 0;
+    REQUIRE(buf.Read(read));
+    REQUIRE(read == -1024);
+
+    /* The value stays available, but is no longer new */
+    REQUIRE(!buf.HasNew());
+    REQUIRE(!buf.Read(read));
+    REQUIRE(read == -1024);
+}
+
+TEST_CASE("spsc::TripleBuf - Only the latest value is read",
+          "[tb_latest]") {
+    lockfree::spsc::TripleBuf<uint32_t> buf;
+
+    for (uint32_t i = 0; i < 10U; i++) {
+        buf.Write(i);
+    }
+
+    uint32_t read = 0;
+    REQUIRE(buf.Read(read));
+    REQUIRE(read == 9U);
+
+    buf.Write(10U);
+    REQUIRE(*buf.ReadAcquire() == 10U);
+    REQUIRE(*buf.ReadAcquire() == 10U);
+}
+
+TEST_CASE("spsc::TripleBuf - Write in place", "[tb_write_acquire]") {
+    lockfree::spsc::TripleBuf<Pose> buf;
+
+    Pose *pose = buf.WriteAcquire();
+    pose->stamp = 42U;
+    pose->position[0] = 1.0;
+    REQUIRE(!buf.HasNew());
+    buf.WriteRelease();
+
+    const Pose *read = buf.ReadAcquire();
+    REQUIRE(read->stamp == 42U);
+    REQUIRE(read->position[0] == 1.0);
+
+    /* The producer never gets the buffer the consumer is reading */
+    for (uint64_t i = 0; i < 4U; i++) {
+        Pose *next = buf.WriteAcquire();
+        REQUIRE(next != read);
+        next->stamp = i;
+        buf.WriteRelease();
+    }
+    REQUIRE(read->stamp == 42U);
+}
+
+TEST_CASE("spsc::TripleBuf - Multithreaded consistency",
+          "[tb_multithread]") {
+    lockfree::spsc::TripleBuf<Pose> buf;
+    bool consistent = true;
+
+    std::thread consumer([&buf, &consistent]() {
+        uint64_t last = 0U;
+        Pose read = {};
+        while (last < TEST_MT_TRANSFER_CNT) {
+            if (!buf.Read(read)) {
+                continue;
+            }
+            /* Values are never torn, and never go back in time */
+            const double stamp = static_cast<double>(read.stamp);
+            consistent = consistent && read.stamp >= last &&
+                         read.position[0] == stamp &&
+                         read.position[2] == -stamp;
+            last = read.stamp;
+        }
+    });
+
+    for (uint64_t i = 1; i <= TEST_MT_TRANSFER_CNT; i++) {
+        Pose pose;
+        pose.stamp = i;
+        pose.position[0] = static_cast<double>(i);
+        pose.position[1] = 0.0;
+        pose.position[2] = -static_cast<double>(i);
+        buf.Write(pose);
+    }
+    consumer.join();
+
+    REQUIRE(consistent);
+}
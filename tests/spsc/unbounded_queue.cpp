@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include "lockfree.hpp"
+#include "spsc/unbounded_queue.hpp"
+
+TEST_CASE("spsc::UnboundedQueue - Write to empty and read back",
+          "[spsc_uq_write_empty]") {
+    lockfree::spsc::UnboundedQueue<int16_t, 8> queue;
+
+    int16_t read = 0;
+    REQUIRE(!queue.Pop(read));
+    REQUIRE(queue.EmptyApprox());
+
+    bool const push_success = queue.Push(-1024);
+    REQUIRE(push_success);
+    REQUIRE(queue.SizeApprox() == 1U);
+
+    bool const pop_success = queue.Pop(read);
+    REQUIRE(pop_success);
+    REQUIRE(read == -1024);
+    REQUIRE(!queue.Pop(read));
+}
+
+TEST_CASE("spsc::UnboundedQueue - Grow past the segment size in order",
+          "[spsc_uq_grow]") {
+    lockfree::spsc::UnboundedQueue<uint32_t, 4> queue;
+
+    for (uint32_t i = 0; i < 100U; i++) {
+        REQUIRE(queue.Push(i));
+    }
+    REQUIRE(queue.SizeApprox() == 100U);
+
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 100U; i++) {
+        REQUIRE(queue.Pop(read));
+        REQUIRE(read == i);
+    }
+    REQUIRE(!queue.Pop(read));
+    REQUIRE(queue.EmptyApprox());
+}
+
+TEST_CASE("spsc::UnboundedQueue - Interleaved writes and reads reuse segments",
+          "[spsc_uq_recycle]") {
+    lockfree::spsc::UnboundedQueue<uint64_t, 4> queue;
+
+    uint64_t written = 0;
+    uint64_t expected = 0;
+    for (size_t round = 0; round < 64U; round++) {
+        /* Alternate between bursts spanning several segments and draining */
+        const size_t burst = 1U + (round * 7U) % 13U;
+        for (size_t i = 0; i < burst; i++) {
+            REQUIRE(queue.Push(written++));
+        }
+
+        /* Leave an element behind every other round */
+        uint64_t read = 0;
+        while (queue.SizeApprox() > round % 2U && queue.Pop(read)) {
+            REQUIRE(read == expected);
+            expected++;
+        }
+    }
+
+    uint64_t read = 0;
+    while (queue.Pop(read)) {
+        REQUIRE(read == expected);
+        expected++;
+    }
+    REQUIRE(expected == written);
+}
+
+TEST_CASE("spsc::UnboundedQueue - Optional API", "[spsc_uq_optional_api]") {
+    lockfree::spsc::UnboundedQueue<int16_t, 8> queue;
+
+    REQUIRE(!queue.Pop());
+    REQUIRE(queue.Push(-1024));
+    REQUIRE(queue.Pop() == -1024);
+}
+
+TEST_CASE("spsc::UnboundedQueue - Elements left in the queue are freed",
+          "[spsc_uq_destructor]") {
+    lockfree::spsc::UnboundedQueue<uint32_t, 4> queue;
+
+    for (uint32_t i = 0; i < 50U; i++) {
+        REQUIRE(queue.Push(i));
+    }
+    uint32_t read = 0;
+    for (uint32_t i = 0; i < 25U; i++) {
+        REQUIRE(queue.Pop(read));
+    }
+    for (uint32_t i = 0; i < 10U; i++) {
+        REQUIRE(queue.Push(i));
+    }
+}
+
+TEST_CASE("spsc::UnboundedQueue - Multithreaded write and read",
+          "[spsc_uq_multithread]") {
+    lockfree::spsc::UnboundedQueue<uint64_t, 64> queue;
+    std::vector<uint8_t> ordered(1, false);
+
+    std::thread producer([&queue]() {
+        for (uint64_t i = 0; i < TEST_MT_TRANSFER_CNT; i++) {
+            queue.Push(i);
+        }
+    });
+
+    std::thread consumer([&queue, &ordered]() {
+        bool ok = true;
+        uint64_t expected = 0;
+        while (expected < TEST_MT_TRANSFER_CNT) {
+            uint64_t read = 0;
+            if (queue.Pop(read)) {
+                ok = ok && read == expected;
+                expected++;
+            }
+        }
+        ordered[0] = ok;
+    });
+
+    producer.join();
+    consumer.join();
+
+    REQUIRE(ordered[0]);
+    REQUIRE(queue.EmptyApprox());
+}